@@ -0,0 +1,218 @@
+#define _GNU_SOURCE
+
+#include "CAllocationCounter.h"
+
+#include <dlfcn.h>
+#include <errno.h>
+#include <stdatomic.h>
+#include <stddef.h>
+
+static atomic_bool isCounting = false;
+static atomic_uint_fast64_t allocations = 0;
+static atomic_uint_fast64_t deallocations = 0;
+static atomic_uint_fast64_t allocatedBytes = 0;
+static atomic_uint_fast64_t retains = 0;
+static atomic_uint_fast64_t releases = 0;
+
+static inline bool counting(void) {
+	return atomic_load_explicit(&isCounting, memory_order_relaxed);
+}
+
+static inline void add(atomic_uint_fast64_t *counter, uint64_t value) {
+	atomic_fetch_add_explicit(counter, value, memory_order_relaxed);
+}
+
+static inline void countAllocation(void *pointer, size_t size) {
+	if (pointer != NULL && counting()) {
+		add(&allocations, 1);
+		add(&allocatedBytes, size);
+	}
+}
+
+static inline void countDeallocation(void *pointer) {
+	if (pointer != NULL && counting()) {
+		add(&deallocations, 1);
+	}
+}
+
+// MARK: - Allocations
+
+#if defined(__linux__) && defined(__GLIBC__)
+
+// The allocator entry points defined by the executable take precedence over those
+// of libc, and forward to the glibc implementations. The Swift runtime allocates
+// all objects, boxes and closure contexts through these.
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *pointer, size_t size);
+extern void *__libc_memalign(size_t alignment, size_t size);
+extern void __libc_free(void *pointer);
+
+void *malloc(size_t size) {
+	void *pointer = __libc_malloc(size);
+	countAllocation(pointer, size);
+	return pointer;
+}
+
+void *calloc(size_t count, size_t size) {
+	void *pointer = __libc_calloc(count, size);
+	countAllocation(pointer, count * size);
+	return pointer;
+}
+
+void *realloc(void *pointer, size_t size) {
+	void *newPointer = __libc_realloc(pointer, size);
+	if (newPointer != NULL) {
+		countDeallocation(pointer);
+		countAllocation(newPointer, size);
+	}
+	return newPointer;
+}
+
+void *memalign(size_t alignment, size_t size) {
+	void *pointer = __libc_memalign(alignment, size);
+	countAllocation(pointer, size);
+	return pointer;
+}
+
+void *aligned_alloc(size_t alignment, size_t size) {
+	return memalign(alignment, size);
+}
+
+int posix_memalign(void **result, size_t alignment, size_t size) {
+	void *pointer = memalign(alignment, size);
+	if (pointer == NULL) {
+		return ENOMEM;
+	}
+	*result = pointer;
+	return 0;
+}
+
+void free(void *pointer) {
+	countDeallocation(pointer);
+	__libc_free(pointer);
+}
+
+bool CAllocationCounterSupportsAllocations(void) {
+	return true;
+}
+
+#else
+
+bool CAllocationCounterSupportsAllocations(void) {
+	return false;
+}
+
+#endif
+
+// MARK: - Reference counting
+
+// The Swift runtime routes `swift_retain` and `swift_release` through these
+// instrumentation hooks. Newer runtimes consult the hooks only if swizzling has
+// been enabled through the flag.
+
+typedef void *(*RetainHook)(void *object);
+typedef void *(*RetainNHook)(void *object, uint32_t count);
+typedef void (*ReleaseHook)(void *object);
+typedef void (*ReleaseNHook)(void *object, uint32_t count);
+
+static RetainHook originalRetain;
+static RetainNHook originalRetainN;
+static ReleaseHook originalRelease;
+static ReleaseNHook originalReleaseN;
+
+static void *countingRetain(void *object) {
+	if (counting()) {
+		add(&retains, 1);
+	}
+	return originalRetain(object);
+}
+
+static void *countingRetainN(void *object, uint32_t count) {
+	if (counting()) {
+		add(&retains, count);
+	}
+	return originalRetainN(object, count);
+}
+
+static void countingRelease(void *object) {
+	if (counting()) {
+		add(&releases, 1);
+	}
+	originalRelease(object);
+}
+
+static void countingReleaseN(void *object, uint32_t count) {
+	if (counting()) {
+		add(&releases, count);
+	}
+	originalReleaseN(object, count);
+}
+
+static bool installReferenceCountingHooks(void) {
+	static atomic_int state = 0; // 0: not installed, 1: installed, -1: unsupported.
+
+	int currentState = atomic_load(&state);
+	if (currentState != 0) {
+		return currentState == 1;
+	}
+
+	RetainHook *retainHook = dlsym(RTLD_DEFAULT, "_swift_retain");
+	RetainNHook *retainNHook = dlsym(RTLD_DEFAULT, "_swift_retain_n");
+	ReleaseHook *releaseHook = dlsym(RTLD_DEFAULT, "_swift_release");
+	ReleaseNHook *releaseNHook = dlsym(RTLD_DEFAULT, "_swift_release_n");
+
+	if (retainHook == NULL || retainNHook == NULL || releaseHook == NULL || releaseNHook == NULL) {
+		atomic_store(&state, -1);
+		return false;
+	}
+
+	originalRetain = *retainHook;
+	originalRetainN = *retainNHook;
+	originalRelease = *releaseHook;
+	originalReleaseN = *releaseNHook;
+
+	*retainHook = countingRetain;
+	*retainNHook = countingRetainN;
+	*releaseHook = countingRelease;
+	*releaseNHook = countingReleaseN;
+
+	bool *enablesSwizzling = dlsym(RTLD_DEFAULT, "_swift_enableSwizzlingOfAllocationAndRefCountingFunctions_forInstrumentsOnly");
+	if (enablesSwizzling != NULL) {
+		*enablesSwizzling = true;
+	}
+
+	atomic_store(&state, 1);
+	return true;
+}
+
+bool CAllocationCounterSupportsReferenceCounting(void) {
+	return installReferenceCountingHooks();
+}
+
+// MARK: - Counting
+
+void CAllocationCounterStart(void) {
+	installReferenceCountingHooks();
+
+	atomic_store(&allocations, 0);
+	atomic_store(&deallocations, 0);
+	atomic_store(&allocatedBytes, 0);
+	atomic_store(&retains, 0);
+	atomic_store(&releases, 0);
+	atomic_store(&isCounting, true);
+}
+
+CAllocationCounters CAllocationCounterStop(void) {
+	atomic_store(&isCounting, false);
+
+	CAllocationCounters counters = {
+		.allocations = atomic_load(&allocations),
+		.deallocations = atomic_load(&deallocations),
+		.allocatedBytes = atomic_load(&allocatedBytes),
+		.retains = atomic_load(&retains),
+		.releases = atomic_load(&releases),
+	};
+	return counters;
+}
@@ -0,0 +1,31 @@
+#ifndef CALLOCATIONCOUNTER_H
+#define CALLOCATIONCOUNTER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/// The counters of heap allocations and reference counting operations, since
+/// counting was last started.
+typedef struct {
+	uint64_t allocations;
+	uint64_t deallocations;
+	uint64_t allocatedBytes;
+	uint64_t retains;
+	uint64_t releases;
+} CAllocationCounters;
+
+/// Whether heap allocations can be counted on this platform. It requires the
+/// interposition of `malloc` and `free`, which is supported only with glibc.
+bool CAllocationCounterSupportsAllocations(void);
+
+/// Whether retains and releases can be counted by the current Swift runtime. It
+/// requires the instrumentation hooks of the runtime.
+bool CAllocationCounterSupportsReferenceCounting(void);
+
+/// Reset the counters, and start counting on all threads.
+void CAllocationCounterStart(void);
+
+/// Stop counting, and return the counters.
+CAllocationCounters CAllocationCounterStop(void);
+
+#endif
@@ -0,0 +1,56 @@
+import CAllocationCounter
+
+/// The heap allocations and reference counting operations made by a benchmark run,
+/// normalized by the operations it performs.
+///
+/// Allocations are counted through the interposition of `malloc` and `free`, which
+/// is supported only on Linux. Retains and releases are counted through the
+/// instrumentation hooks of the Swift runtime. A measurement that is unsupported
+/// on the platform is `nil`.
+struct AllocationMeasurement: Encodable {
+	let allocations: UInt64?
+	let deallocations: UInt64?
+	let allocatedBytes: UInt64?
+	let retains: UInt64?
+	let releases: UInt64?
+
+	let allocationsPerOperation: Double?
+	let allocatedBytesPerOperation: Double?
+	let retainsPerOperation: Double?
+	let releasesPerOperation: Double?
+
+	/// Count the heap allocations and reference counting operations made by
+	/// `action`, on all threads.
+	///
+	/// - parameters:
+	///   - operations: The number of operations performed by `action`.
+	///   - action: The action to be measured.
+	init(operations: Int, _ action: () -> Void) {
+		let supportsAllocations = CAllocationCounterSupportsAllocations()
+		let supportsReferenceCounting = CAllocationCounterSupportsReferenceCounting()
+
+		CAllocationCounterStart()
+		action()
+		let counters = CAllocationCounterStop()
+
+		func normalized(_ value: UInt64?) -> Double? {
+			return value.map { Double($0) / Double(max(operations, 1)) }
+		}
+
+		let allocations: UInt64? = supportsAllocations ? counters.allocations : nil
+		let allocatedBytes: UInt64? = supportsAllocations ? counters.allocatedBytes : nil
+		let retains: UInt64? = supportsReferenceCounting ? counters.retains : nil
+		let releases: UInt64? = supportsReferenceCounting ? counters.releases : nil
+
+		self.allocations = allocations
+		self.deallocations = supportsAllocations ? counters.deallocations : nil
+		self.allocatedBytes = allocatedBytes
+		self.retains = retains
+		self.releases = releases
+
+		allocationsPerOperation = normalized(allocations)
+		allocatedBytesPerOperation = normalized(allocatedBytes)
+		retainsPerOperation = normalized(retains)
+		releasesPerOperation = normalized(releases)
+	}
+}
@@ -0,0 +1,105 @@
+import Dispatch
+import Foundation
+import ReactiveSwift
+
+/// Benchmarks of reading a file in chunks of a varying size, and of splitting it into
+/// lines.
+///
+/// The file is written once to the temporary directory. Its size is 256 MiB, or the
+/// number of MiB given by `REACTIVESWIFT_BENCHMARK_FILE_MIB`, so that the chunk sizes
+/// can be tuned on files of several GiB. Every benchmark operation is a byte read.
+enum FileBenchmarks {
+	static var all: [Benchmark] {
+		return chunks + lines
+	}
+
+	static let chunkSizes = [1 << 16, 1 << 20, 1 << 23]
+
+	/// Bytes per second read through a `FileHandle` and through a mapped file.
+	static var chunks: [Benchmark] {
+		return chunkSizes.flatMap { size -> [Benchmark] in
+			[
+				Benchmark(suite: "file", name: "handle-chunks", parameters: ["size": size], operations: file.size) { context in
+					guard let handle = try? FileHandle(forReadingFrom: file.url) else { fatalError("Failed to open \(file.url).") }
+					defer { handle.closeFile() }
+
+					var chunks = 0
+					var bytes = 0
+					let result = handle.reactive.chunks(ofSize: size, on: scheduler)
+						.on(value: { chunk in
+							chunks += 1
+							bytes += chunk.count
+						})
+						.wait()
+
+					precondition(result.error == nil && bytes == file.size)
+					context.record("chunks", chunks)
+				},
+				Benchmark(suite: "file", name: "mapped-chunks", parameters: ["size": size], operations: file.size) { context in
+					var chunks = 0
+					var checksum: UInt8 = 0
+					let result = FileManager.default.reactive.chunks(ofFileAt: file.url, size: size, on: scheduler)
+						.on(value: { chunk in
+							// Touch every page, so that the mapped bytes are read.
+							chunks += 1
+							for index in stride(from: chunk.startIndex, to: chunk.endIndex, by: 4_096) {
+								checksum = checksum &+ chunk[index]
+							}
+						})
+						.wait()
+
+					precondition(result.error == nil)
+					blackHole(checksum)
+					context.record("chunks", chunks)
+				},
+			]
+		}
+	}
+
+	/// Bytes per second split into lines of 100 bytes.
+	static var lines: [Benchmark] {
+		return chunkSizes.map { size in
+			Benchmark(suite: "file", name: "mapped-lines", parameters: ["size": size], operations: file.size) { context in
+				var lines = 0
+				let result = FileManager.default.reactive.chunks(ofFileAt: file.url, size: size, on: scheduler)
+					.lines()
+					.on(value: { _ in lines += 1 })
+					.wait()
+
+				precondition(result.error == nil)
+				context.record("lines", lines)
+			}
+		}
+	}
+
+	private static let scheduler = QueueScheduler(qos: .userInitiated, name: "org.reactivecocoa.ReactiveSwift.Benchmarks.file")
+
+	/// The file read by the benchmarks, of lines of 100 bytes.
+	private static let file: (url: URL, size: Int) = {
+		let mebibytes = ProcessInfo.processInfo.environment["REACTIVESWIFT_BENCHMARK_FILE_MIB"].flatMap { Int($0) } ?? 256
+		let url = FileManager.default.temporaryDirectory.appendingPathComponent("ReactiveSwiftBenchmarks-\(mebibytes)MiB.txt")
+
+		var line = Data(repeating: UInt8(ascii: "x"), count: 99)
+		line.append(UInt8(ascii: "\n"))
+
+		var block = Data()
+		for _ in 0 ..< (1 << 20) / line.count {
+			block.append(line)
+		}
+
+		let attributes = try? FileManager.default.attributesOfItem(atPath: url.path)
+		if attributes?[.size] as? Int == block.count * mebibytes {
+			return (url, block.count * mebibytes)
+		}
+
+		FileManager.default.createFile(atPath: url.path, contents: nil)
+		guard let handle = try? FileHandle(forWritingTo: url) else { fatalError("Failed to create \(url).") }
+
+		for _ in 0 ..< mebibytes {
+			handle.write(block)
+		}
+		handle.closeFile()
+
+		return (url, block.count * mebibytes)
+	}()
+}
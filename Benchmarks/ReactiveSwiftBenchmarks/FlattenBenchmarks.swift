@@ -0,0 +1,92 @@
+import ReactiveSwift
+
+/// Benchmarks of the flatten strategies and of the combining operators.
+enum FlattenBenchmarks {
+	static var all: [Benchmark] {
+		return fanOut + sequencing + combining
+	}
+
+	/// Events per second through `flatMap` with inner producers of a varying count.
+	static var fanOut: [Benchmark] {
+		let events = 100_000
+		let strategies: [(String, FlattenStrategy)] = [("merge", .merge), ("concat", .concat), ("latest", .latest)]
+
+		return strategies.flatMap { name, strategy in
+			[10, 1_000].map { inners -> Benchmark in
+				Benchmark(suite: "flatten", name: name, parameters: ["inners": inners], operations: events) { _ in
+					let eventsPerInner = events / inners
+					var sum = 0
+
+					SignalProducer<Int, Never>(0 ..< inners)
+						.flatMap(strategy) { _ in SignalProducer<Int, Never>(0 ..< eventsPerInner) }
+						.startWithValues { sum = sum &+ $0 }
+
+					blackHole(sum)
+				}
+			}
+		}
+	}
+
+	/// Producers per second started one after another by `repeat` and `concat`, when
+	/// every producer completes synchronously.
+	static var sequencing: [Benchmark] {
+		let producers = 1_000_000
+
+		return [
+			Benchmark(suite: "flatten", name: "repeat", parameters: ["producers": producers], operations: producers) { _ in
+				var sum = 0
+
+				SignalProducer<Int, Never>(value: 1)
+					.repeat(producers)
+					.startWithValues { sum = sum &+ $0 }
+
+				blackHole(sum)
+			},
+			Benchmark(suite: "flatten", name: "concat", parameters: ["producers": producers], operations: producers) { _ in
+				var sum = 0
+
+				SignalProducer<Int, Never>(0 ..< producers)
+					.flatMap(.concat) { SignalProducer<Int, Never>(value: $0) }
+					.startWithValues { sum = sum &+ $0 }
+
+				blackHole(sum)
+			},
+		]
+	}
+
+	/// Events per second through `combineLatest` and `zip` of a varying arity.
+	static var combining: [Benchmark] {
+		let events = 100_000
+
+		return [2, 4, 8, 16].flatMap { arity -> [Benchmark] in
+			[
+				Benchmark(suite: "signal", name: "combineLatest", parameters: ["arity": arity], operations: events) { _ in
+					let pipes = (0 ..< arity).map { _ in Signal<Int, Never>.pipe() }
+
+					var count = 0
+					Signal.combineLatest(pipes.map { $0.output }).observeValues { count += $0.count }
+
+					for value in 0 ..< events {
+						pipes[value % arity].input.send(value: value)
+					}
+					pipes.forEach { $0.input.sendCompleted() }
+
+					blackHole(count)
+				},
+				Benchmark(suite: "signal", name: "zip", parameters: ["arity": arity], operations: events) { _ in
+					let pipes = (0 ..< arity).map { _ in Signal<Int, Never>.pipe() }
+
+					var count = 0
+					Signal.zip(pipes.map { $0.output }).observeValues { count += $0.count }
+
+					for value in 0 ..< events {
+						pipes[value % arity].input.send(value: value)
+					}
+					pipes.forEach { $0.input.sendCompleted() }
+
+					blackHole(count)
+				},
+			]
+		}
+	}
+}
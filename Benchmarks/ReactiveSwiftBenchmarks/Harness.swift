@@ -0,0 +1,169 @@
+import Dispatch
+import Foundation
+
+/// A benchmark measures the time taken by `run` to perform `operations` units of
+/// work, e.g. events delivered or values read.
+struct Benchmark {
+	/// The suite the benchmark belongs to.
+	let suite: String
+
+	/// The name of the benchmark, unique within its suite.
+	let name: String
+
+	/// The parameters the benchmark is instantiated with, e.g. the depth of an
+	/// operator chain.
+	let parameters: [String: Int]
+
+	/// The number of units of work performed by one run.
+	let operations: Int
+
+	/// Perform one run of the benchmark. Any counter recorded to the context is
+	/// reported alongside the timings.
+	let run: (BenchmarkContext) -> Void
+
+	/// The fully qualified identifier of the benchmark, including its parameters.
+	var identifier: String {
+		let parameters = self.parameters
+			.sorted { $0.key < $1.key }
+			.map { "\($0.key)=\($0.value)" }
+			.joined(separator: ",")
+		return parameters.isEmpty ? "\(suite)/\(name)" : "\(suite)/\(name)[\(parameters)]"
+	}
+
+	init(suite: String, name: String, parameters: [String: Int] = [:], operations: Int, run: @escaping (BenchmarkContext) -> Void) {
+		self.suite = suite
+		self.name = name
+		self.parameters = parameters
+		self.operations = operations
+		self.run = run
+	}
+}
+
+/// The context of a benchmark run, which collects the counters reported by the
+/// benchmark.
+final class BenchmarkContext {
+	private(set) var counters: [String: Double] = [:]
+
+	/// Record the value of a counter. The value of the last run is reported.
+	///
+	/// - parameters:
+	///   - name: The name of the counter.
+	///   - value: The value of the counter.
+	func record(_ name: String, _ value: Double) {
+		counters[name] = value
+	}
+
+	/// Record the value of a counter. The value of the last run is reported.
+	///
+	/// - parameters:
+	///   - name: The name of the counter.
+	///   - value: The value of the counter.
+	func record(_ name: String, _ value: Int) {
+		record(name, Double(value))
+	}
+}
+
+/// The measurements of a benchmark.
+struct BenchmarkResult: Encodable {
+	let identifier: String
+	let suite: String
+	let name: String
+	let parameters: [String: Int]
+	let operations: Int
+
+	/// The duration of every measured run, in nanoseconds.
+	let samples: [UInt64]
+
+	let minimumNanoseconds: UInt64
+	let medianNanoseconds: UInt64
+	let meanNanoseconds: Double
+
+	/// The number of operations per second, based on the median run.
+	let operationsPerSecond: Double
+
+	/// The duration of an operation, in nanoseconds, based on the median run.
+	let nanosecondsPerOperation: Double
+
+	let counters: [String: Double]
+
+	/// The allocations and reference counting operations of an additional run, if
+	/// allocation counting has been requested.
+	let allocations: AllocationMeasurement?
+}
+
+/// The report of a benchmark session.
+struct BenchmarkReport: Encodable {
+	/// The version of the report format.
+	let formatVersion = 1
+
+	/// An arbitrary label for the session, e.g. a commit hash.
+	let label: String?
+
+	/// The time the session started, as seconds since 1970.
+	let timestamp: Double
+
+	let configuration: String
+	let platform: String
+	let samplesPerBenchmark: Int
+	let results: [BenchmarkResult]
+}
+
+/// Runs benchmarks and measures their durations.
+struct BenchmarkRunner {
+	/// The number of measured runs of each benchmark.
+	let samples: Int
+
+	/// The number of unmeasured runs of each benchmark before measuring.
+	let warmups: Int
+
+	/// Whether the allocations and reference counting operations of an additional,
+	/// untimed run should be counted.
+	let countsAllocations: Bool
+
+	func measure(_ benchmark: Benchmark) -> BenchmarkResult {
+		let context = BenchmarkContext()
+
+		for _ in 0 ..< warmups {
+			benchmark.run(context)
+		}
+
+		var durations: [UInt64] = []
+		durations.reserveCapacity(samples)
+
+		for _ in 0 ..< samples {
+			let start = DispatchTime.now().uptimeNanoseconds
+			benchmark.run(context)
+			let end = DispatchTime.now().uptimeNanoseconds
+			durations.append(end - start)
+		}
+
+		let allocations = countsAllocations
+			? AllocationMeasurement(operations: benchmark.operations) { benchmark.run(context) }
+			: nil
+
+		let sorted = durations.sorted()
+		let median = sorted[sorted.count / 2]
+		let mean = Double(durations.reduce(0, +)) / Double(durations.count)
+		let medianSeconds = max(Double(median), 1) / 1e9
+
+		return BenchmarkResult(
+			identifier: benchmark.identifier,
+			suite: benchmark.suite,
+			name: benchmark.name,
+			parameters: benchmark.parameters,
+			operations: benchmark.operations,
+			samples: durations,
+			minimumNanoseconds: sorted[0],
+			medianNanoseconds: median,
+			meanNanoseconds: mean,
+			operationsPerSecond: Double(benchmark.operations) / medianSeconds,
+			nanosecondsPerOperation: Double(median) / Double(max(benchmark.operations, 1)),
+			counters: context.counters,
+			allocations: allocations
+		)
+	}
+}
+
+/// Consume a value, so that the computation of it would not be optimized away.
+@inline(never)
+func blackHole<T>(_ value: T) {}
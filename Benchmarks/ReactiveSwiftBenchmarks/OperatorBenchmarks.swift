@@ -0,0 +1,74 @@
+import ReactiveSwift
+
+/// Benchmarks of the individual `Signal` and `SignalProducer` operators, per event
+/// and per start. Together with `--allocations`, these report the allocations and
+/// reference counting operations of every operator.
+enum OperatorBenchmarks {
+	static let events = 10_000
+	static let starts = 10_000
+
+	static var all: [Benchmark] {
+		let groups: [[Benchmark]] = [
+			benchmarks("map", { $0.map { $0 &+ 1 } }, { $0.map { $0 &+ 1 } }),
+			benchmarks("filter", { $0.filter { $0 % 2 == 0 } }, { $0.filter { $0 % 2 == 0 } }),
+			benchmarks("compactMap", { $0.compactMap { $0 % 2 == 0 ? $0 : nil } }, { $0.compactMap { $0 % 2 == 0 ? $0 : nil } }),
+			benchmarks("attemptMap", { $0.attemptMap { Result<Int, Never>.success($0) } }, { $0.attemptMap { Result<Int, Never>.success($0) } }),
+			benchmarks("mapError", { $0.mapError { $0 } }, { $0.mapError { $0 } }),
+			benchmarks("materialize", { $0.materialize() }, { $0.materialize() }),
+			benchmarks("materializeResults", { $0.materializeResults() }, { $0.materializeResults() }),
+			benchmarks("dematerialize", { $0.materialize().dematerialize() }, { $0.materialize().dematerialize() }),
+			benchmarks("dematerializeResults", { $0.materializeResults().dematerializeResults() }, { $0.materializeResults().dematerializeResults() }),
+			benchmarks("collect", { $0.collect(count: 16) }, { $0.collect(count: 16) }),
+			benchmarks("combinePrevious", { $0.combinePrevious() }, { $0.combinePrevious() }),
+			benchmarks("reduce", { $0.reduce(0) { $0 &+ $1 } }, { $0.reduce(0) { $0 &+ $1 } }),
+			benchmarks("scan", { $0.scan(0) { $0 &+ $1 } }, { $0.scan(0) { $0 &+ $1 } }),
+			benchmarks("scanMap", { $0.scanMap(0) { ($0 &+ $1, $1) } }, { $0.scanMap(0) { ($0 &+ $1, $1) } }),
+			benchmarks("skipFirst", { $0.skip(first: 1) }, { $0.skip(first: 1) }),
+			benchmarks("skipRepeats", { $0.skipRepeats() }, { $0.skipRepeats() }),
+			benchmarks("skipWhile", { $0.skip(while: { $0 < 1 }) }, { $0.skip(while: { $0 < 1 }) }),
+			benchmarks("takeFirst", { $0.take(first: .max) }, { $0.take(first: .max) }),
+			benchmarks("takeLast", { $0.take(last: 1) }, { $0.take(last: 1) }),
+			benchmarks("takeWhile", { $0.take(while: { $0 >= 0 }) }, { $0.take(while: { $0 >= 0 }) }),
+			benchmarks("uniqueValues", { $0.uniqueValues() }, { $0.uniqueValues() }),
+		]
+
+		return groups.flatMap { $0 }
+	}
+
+	/// Create the benchmarks of an operator.
+	///
+	/// - parameters:
+	///   - name: The name of the operator.
+	///   - signalOperator: The operator applied to a `Signal`.
+	///   - producerOperator: The operator applied to a `SignalProducer`.
+	///
+	/// - returns: The benchmarks of the delivery of events through the operator, and
+	///            of the start of a producer with the operator applied.
+	private static func benchmarks<U, V>(
+		_ name: String,
+		_ signalOperator: @escaping (Signal<Int, Never>) -> Signal<U, Never>,
+		_ producerOperator: @escaping (SignalProducer<Int, Never>) -> SignalProducer<V, Never>
+	) -> [Benchmark] {
+		return [
+			Benchmark(suite: "operator.signal", name: name, operations: events) { _ in
+				let (signal, observer) = Signal<Int, Never>.pipe()
+				signalOperator(signal).observeValues { blackHole($0) }
+
+				for value in 0 ..< events {
+					observer.send(value: value)
+				}
+				observer.sendCompleted()
+			},
+			Benchmark(suite: "operator.producer", name: name, operations: events) { _ in
+				producerOperator(SignalProducer(0 ..< events)).startWithValues { blackHole($0) }
+			},
+			Benchmark(suite: "operator.producer-start", name: name, operations: starts) { _ in
+				let producer = producerOperator(SignalProducer(value: 1))
+
+				for _ in 0 ..< starts {
+					producer.startWithValues { blackHole($0) }
+				}
+			},
+		]
+	}
+}
@@ -0,0 +1,75 @@
+import ReactiveSwift
+
+/// Benchmarks of fused pipelines against the equivalent chains of operators.
+enum PipelineBenchmarks {
+	static let events = 100_000
+
+	static var all: [Benchmark] {
+		return [
+			Benchmark(suite: "pipeline.signal", name: "chained", operations: events) { _ in
+				let (signal, observer) = Signal<Int, Never>.pipe()
+				var sum = 0
+
+				signal
+					.map { $0 &* 3 }
+					.filter { $0 % 2 == 0 }
+					.compactMap { $0 % 5 == 0 ? nil : $0 }
+					.scan(0) { $0 &+ $1 }
+					.observeValues { sum = sum &+ $0 }
+
+				for value in 0 ..< events {
+					observer.send(value: value)
+				}
+				observer.sendCompleted()
+
+				blackHole(sum)
+			},
+			Benchmark(suite: "pipeline.signal", name: "fused", operations: events) { _ in
+				let (signal, observer) = Signal<Int, Never>.pipe()
+				var sum = 0
+
+				signal
+					.pipeline {
+						Pipeline.Map { (value: Int) in value &* 3 }
+						Pipeline.Filter { (value: Int) in value % 2 == 0 }
+						Pipeline.CompactMap { (value: Int) in value % 5 == 0 ? nil : value }
+						Pipeline.Scan(0) { (total: Int, value: Int) in total &+ value }
+					}
+					.observeValues { sum = sum &+ $0 }
+
+				for value in 0 ..< events {
+					observer.send(value: value)
+				}
+				observer.sendCompleted()
+
+				blackHole(sum)
+			},
+			Benchmark(suite: "pipeline.producer", name: "chained", operations: events) { _ in
+				var sum = 0
+
+				SignalProducer<Int, Never>(0 ..< events)
+					.map { $0 &* 3 }
+					.filter { $0 % 2 == 0 }
+					.compactMap { $0 % 5 == 0 ? nil : $0 }
+					.scan(0) { $0 &+ $1 }
+					.startWithValues { sum = sum &+ $0 }
+
+				blackHole(sum)
+			},
+			Benchmark(suite: "pipeline.producer", name: "fused", operations: events) { _ in
+				var sum = 0
+
+				SignalProducer<Int, Never>(0 ..< events)
+					.pipeline {
+						Pipeline.Map { (value: Int) in value &* 3 }
+						Pipeline.Filter { (value: Int) in value % 2 == 0 }
+						Pipeline.CompactMap { (value: Int) in value % 5 == 0 ? nil : value }
+						Pipeline.Scan(0) { (total: Int, value: Int) in total &+ value }
+					}
+					.startWithValues { sum = sum &+ $0 }
+
+				blackHole(sum)
+			},
+		]
+	}
+}
@@ -0,0 +1,147 @@
+import Dispatch
+import ReactiveSwift
+
+/// Benchmarks of property reads, writes and change propagation.
+enum PropertyBenchmarks {
+	static var all: [Benchmark] {
+		return reads + writes + propagation
+	}
+
+	/// Reads per second of a property by a varying number of concurrent readers,
+	/// while a writer keeps modifying it.
+	static var reads: [Benchmark] {
+		let readsPerThread = 100_000
+
+		return [1, 2, 4, 8, 16, 32].map { threads in
+			Benchmark(suite: "property", name: "concurrent-reads", parameters: ["threads": threads], operations: threads * readsPerThread) { _ in
+				let property = MutableProperty(0)
+				let composed = property.map { $0 + 1 }
+				let isDone = Atomic(false)
+
+				let writer = DispatchQueue(label: "org.reactivecocoa.ReactiveSwift.Benchmarks.writer")
+				let group = DispatchGroup()
+
+				writer.async(group: group) {
+					var value = 0
+					while !isDone.value {
+						value += 1
+						property.value = value
+					}
+				}
+
+				DispatchQueue.concurrentPerform(iterations: threads) { _ in
+					var sum = 0
+					for index in 0 ..< readsPerThread {
+						sum = sum &+ (index % 2 == 0 ? property.value : composed.value)
+					}
+					blackHole(sum)
+				}
+
+				isDone.value = true
+				group.wait()
+			}
+		}
+	}
+
+	/// Writes per second, and the emissions caused by them.
+	static var writes: [Benchmark] {
+		let writes = 100_000
+
+		return [
+			Benchmark(suite: "property", name: "write", operations: writes) { context in
+				let property = MutableProperty(0)
+
+				var emissions = 0
+				property.signal.observeValues { _ in emissions += 1 }
+
+				for _ in 0 ..< writes {
+					property.value = 1
+				}
+
+				context.record("emissions", emissions)
+			},
+			Benchmark(suite: "property", name: "write-skipping-repeats", operations: writes) { context in
+				let property = MutableProperty(skippingRepeats: 0)
+
+				var emissions = 0
+				property.signal.observeValues { _ in emissions += 1 }
+
+				for _ in 0 ..< writes {
+					property.value = 1
+				}
+
+				context.record("emissions", emissions)
+			},
+		]
+	}
+
+	/// The recomputations and emissions of composed properties as their sources
+	/// change.
+	static var propagation: [Benchmark] {
+		let changes = 10_000
+
+		let diamonds = [false, true].map { isTransactional in
+			Benchmark(suite: "property", name: "diamond", parameters: ["transaction": isTransactional ? 1 : 0], operations: changes) { context in
+				let source = MutableProperty(0)
+				let left = source.map { $0 + 1 }
+				let right = source.map { $0 * 2 }
+
+				var recomputations = 0
+				let sum = left.combineLatest(with: right).map { (left: Int, right: Int) -> Int in
+					recomputations += 1
+					return left + right
+				}
+
+				var emissions = 0
+				sum.signal.observeValues { _ in emissions += 1 }
+				recomputations = 0
+
+				for value in 1 ... changes {
+					if isTransactional {
+						PropertyTransaction.perform { source.value = value }
+					} else {
+						source.value = value
+					}
+				}
+
+				context.record("recomputations_per_change", Double(recomputations) / Double(changes))
+				context.record("emissions_per_change", Double(emissions) / Double(changes))
+			}
+		}
+
+		return diamonds + [
+			Benchmark(suite: "property", name: "transaction", parameters: ["writes": 8], operations: changes) { context in
+				let sources = (0 ..< 8).map { _ in MutableProperty(0) }
+				let sum = Property<Int>.combineLatest(sources)!.map { $0.reduce(0, +) }
+
+				var emissions = 0
+				sum.signal.observeValues { _ in emissions += 1 }
+
+				for value in 1 ... changes {
+					PropertyTransaction.perform {
+						for source in sources {
+							source.value = value
+						}
+					}
+				}
+
+				context.record("emissions_per_transaction", Double(emissions) / Double(changes))
+			},
+			Benchmark(suite: "property", name: "no-transaction", parameters: ["writes": 8], operations: changes) { context in
+				let sources = (0 ..< 8).map { _ in MutableProperty(0) }
+				let sum = Property<Int>.combineLatest(sources)!.map { $0.reduce(0, +) }
+
+				var emissions = 0
+				sum.signal.observeValues { _ in emissions += 1 }
+
+				for value in 1 ... changes {
+					for source in sources {
+						source.value = value
+					}
+				}
+
+				context.record("emissions_per_transaction", Double(emissions) / Double(changes))
+			},
+		]
+	}
+}
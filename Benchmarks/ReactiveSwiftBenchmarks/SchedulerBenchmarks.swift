@@ -0,0 +1,98 @@
+import Dispatch
+import ReactiveSwift
+
+/// Benchmarks of the delivery of events across schedulers.
+enum SchedulerBenchmarks {
+	static var all: [Benchmark] {
+		return hops + bindings
+	}
+
+	/// The latency of hopping to a `QueueScheduler` and back, and the throughput
+	/// of `observe(on:)`.
+	static var hops: [Benchmark] {
+		let hops = 1_000
+		let events = 100_000
+
+		return [
+			Benchmark(suite: "scheduler", name: "queue-round-trip", operations: hops) { _ in
+				let scheduler = QueueScheduler(name: "org.reactivecocoa.ReactiveSwift.Benchmarks.hop")
+				let semaphore = DispatchSemaphore(value: 0)
+
+				for _ in 0 ..< hops {
+					scheduler.schedule { semaphore.signal() }
+					semaphore.wait()
+				}
+			},
+			Benchmark(suite: "scheduler", name: "observe-on-queue", operations: events) { _ in
+				let scheduler = QueueScheduler(name: "org.reactivecocoa.ReactiveSwift.Benchmarks.observeOn")
+				let semaphore = DispatchSemaphore(value: 0)
+				let (signal, observer) = Signal<Int, Never>.pipe()
+
+				var sum = 0
+				signal
+					.observe(on: scheduler)
+					.observe { event in
+						switch event {
+						case let .value(value):
+							sum = sum &+ value
+						case .completed, .failed, .interrupted:
+							semaphore.signal()
+						}
+					}
+
+				for value in 0 ..< events {
+					observer.send(value: value)
+				}
+				observer.sendCompleted()
+				semaphore.wait()
+
+				blackHole(sum)
+			},
+		]
+	}
+
+	/// The blocks scheduled by a binding target on a scheduler, with and without
+	/// coalescing.
+	static var bindings: [Benchmark] {
+		let values = 100_000
+
+		return [false, true].map { coalescing in
+			Benchmark(suite: "binding", name: coalescing ? "coalescing-target" : "target", operations: values) { context in
+				let scheduler = CountingScheduler(QueueScheduler(name: "org.reactivecocoa.ReactiveSwift.Benchmarks.binding"))
+				let (lifetime, token) = Lifetime.make()
+				let (signal, observer) = Signal<Int, Never>.pipe()
+
+				var latest = 0
+				let target = BindingTarget(on: scheduler, coalescing: coalescing, lifetime: lifetime) { latest = $0 }
+				target <~ signal
+
+				for value in 1 ... values {
+					observer.send(value: value)
+				}
+
+				let semaphore = DispatchSemaphore(value: 0)
+				scheduler.schedule { semaphore.signal() }
+				semaphore.wait()
+
+				context.record("scheduled_blocks", scheduler.count.value - 1)
+				blackHole(latest)
+				withExtendedLifetime(token) {}
+			}
+		}
+	}
+}
+
+/// A scheduler which counts the blocks it schedules on another scheduler.
+private final class CountingScheduler: Scheduler {
+	let count = Atomic(0)
+	private let scheduler: Scheduler
+
+	init(_ scheduler: Scheduler) {
+		self.scheduler = scheduler
+	}
+
+	func schedule(_ action: @escaping () -> Void) -> Disposable? {
+		count.modify { $0 += 1 }
+		return scheduler.schedule(action)
+	}
+}
@@ -0,0 +1,144 @@
+import ReactiveSwift
+
+/// Benchmarks of event delivery through `Signal`, `SignalProducer` operator chains,
+/// and the observer bookkeeping underneath them.
+enum SignalBenchmarks {
+	static let events = 100_000
+
+	static var all: [Benchmark] {
+		return chains + sequences + churn + primitives
+	}
+
+	/// Events per second through chains of `map` of varying depth.
+	static var chains: [Benchmark] {
+		return [1, 4, 16].flatMap { depth -> [Benchmark] in
+			[
+				Benchmark(suite: "signal", name: "map-chain", parameters: ["depth": depth], operations: events) { _ in
+					let (signal, observer) = Signal<Int, Never>.pipe()
+
+					var output = signal
+					for _ in 0 ..< depth {
+						output = output.map { $0 &+ 1 }
+					}
+
+					var sum = 0
+					output.observeValues { sum = sum &+ $0 }
+
+					for value in 0 ..< events {
+						observer.send(value: value)
+					}
+					observer.sendCompleted()
+
+					blackHole(sum)
+				},
+				Benchmark(suite: "producer", name: "map-chain", parameters: ["depth": depth], operations: events) { _ in
+					var producer = SignalProducer<Int, Never>(0 ..< events)
+					for _ in 0 ..< depth {
+						producer = producer.map { $0 &+ 1 }
+					}
+
+					var sum = 0
+					producer.startWithValues { sum = sum &+ $0 }
+
+					blackHole(sum)
+				},
+			]
+		}
+	}
+
+	/// Values per second sent by a producer of a sequence, one at a time, in batches
+	/// of a varying size, and in chunks.
+	static var sequences: [Benchmark] {
+		let values = 1_000_000
+
+		let single = Benchmark(suite: "producer", name: "sequence", operations: values) { _ in
+			var sum = 0
+			SignalProducer<Int, Never>(0 ..< values).startWithValues { sum = sum &+ $0 }
+			blackHole(sum)
+		}
+
+		let batches = [64, 4_096].flatMap { size -> [Benchmark] in
+			[
+				Benchmark(suite: "producer", name: "sequence-batched", parameters: ["size": size], operations: values) { _ in
+					var sum = 0
+					SignalProducer<Int, Never>(0 ..< values, batchSize: size).startWithValues { sum = sum &+ $0 }
+					blackHole(sum)
+				},
+				Benchmark(suite: "producer", name: "sequence-chunked", parameters: ["size": size], operations: values) { _ in
+					var sum = 0
+					SignalProducer<[Int], Never>(chunksOf: 0 ..< values, size: size).startWithValues { chunk in
+						for value in chunk {
+							sum = sum &+ value
+						}
+					}
+					blackHole(sum)
+				},
+			]
+		}
+
+		return [single] + batches
+	}
+
+	/// Observe and dispose cycles on a signal with a varying number of persistent
+	/// observers.
+	static var churn: [Benchmark] {
+		let cycles = 10_000
+
+		return [0, 100, 1_000].flatMap { observers -> [Benchmark] in
+			[
+				Benchmark(suite: "signal", name: "observe-dispose", parameters: ["observers": observers], operations: cycles) { _ in
+					let (signal, observer) = Signal<Int, Never>.pipe()
+					let persistent = (0 ..< observers).map { _ in signal.observeValues { blackHole($0) } }
+
+					for _ in 0 ..< cycles {
+						signal.observeValues { blackHole($0) }?.dispose()
+					}
+
+					persistent.forEach { $0?.dispose() }
+					observer.sendCompleted()
+				},
+				Benchmark(suite: "property", name: "producer-start-dispose", parameters: ["observers": observers], operations: cycles) { _ in
+					let property = MutableProperty(0)
+					let persistent = (0 ..< observers).map { _ in property.producer.startWithValues { blackHole($0) } }
+
+					for _ in 0 ..< cycles {
+						property.producer.startWithValues { blackHole($0) }.dispose()
+					}
+
+					persistent.forEach { $0.dispose() }
+				},
+			]
+		}
+	}
+
+	/// The primitives underneath event delivery.
+	static var primitives: [Benchmark] {
+		let operations = 100_000
+
+		return [
+			Benchmark(suite: "bag", name: "insert-remove-fifo", parameters: ["count": 1_000], operations: operations) { _ in
+				var bag = Bag<Int>()
+				for _ in 0 ..< operations / 1_000 {
+					let tokens = (0 ..< 1_000).map { bag.insert($0) }
+					tokens.forEach { bag.remove(using: $0) }
+				}
+				blackHole(bag)
+			},
+			Benchmark(suite: "bag", name: "insert-remove-lifo", parameters: ["count": 1_000], operations: operations) { _ in
+				var bag = Bag<Int>()
+				for _ in 0 ..< operations / 1_000 {
+					let tokens = (0 ..< 1_000).map { bag.insert($0) }
+					tokens.reversed().forEach { bag.remove(using: $0) }
+				}
+				blackHole(bag)
+			},
+			Benchmark(suite: "atomic", name: "modify", operations: operations) { _ in
+				let atomic = Atomic(0)
+				for _ in 0 ..< operations {
+					atomic.modify { $0 += 1 }
+				}
+				blackHole(atomic.value)
+			},
+		]
+	}
+}
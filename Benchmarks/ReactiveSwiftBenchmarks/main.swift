@@ -0,0 +1,173 @@
+// ReactiveSwiftBenchmarks measures the core delivery paths of ReactiveSwift, and
+// writes the results as JSON, so that they can be compared across commits.
+//
+//     swift run -c release ReactiveSwiftBenchmarks [options]
+//
+// Options:
+//     --filter <substring>   Run only the benchmarks whose identifier contains it.
+//     --samples <count>      The number of measured runs of each benchmark.
+//     --warmups <count>      The number of unmeasured runs of each benchmark.
+//     --label <label>        A label to be included in the report, e.g. a commit.
+//     --output <path>        Write the report to the file instead of stdout.
+//     --allocations          Count the allocations and the retains and releases of
+//                            an additional run of each benchmark.
+//     --budgets <path>       Fail if a benchmark allocates more per operation than
+//                            its budget. The file is a JSON object of benchmark
+//                            identifiers and allocations per operation. It implies
+//                            `--allocations`.
+//     --list                 List the benchmark identifiers, and exit.
+//
+// Environment:
+//     REACTIVESWIFT_BENCHMARK_FILE_MIB
+//                            The size of the file read by the file benchmarks, in
+//                            MiB. The file is written to the temporary directory
+//                            once, and reused by later runs.
+
+import Foundation
+
+let benchmarks = SignalBenchmarks.all
+	+ FlattenBenchmarks.all
+	+ PropertyBenchmarks.all
+	+ SchedulerBenchmarks.all
+	+ OperatorBenchmarks.all
+	+ PipelineBenchmarks.all
+	+ FileBenchmarks.all
+
+func fail(_ message: String) -> Never {
+	FileHandle.standardError.write("error: \(message)\n".data(using: .utf8)!)
+	exit(1)
+}
+
+var filter: String?
+var samples = 10
+var warmups = 1
+var label: String?
+var outputPath: String?
+var listsBenchmarks = false
+var countsAllocations = false
+var budgetsPath: String?
+
+var arguments = CommandLine.arguments.dropFirst().makeIterator()
+
+func nextArgument(for option: String) -> String {
+	guard let argument = arguments.next() else { fail("Missing value for \(option).") }
+	return argument
+}
+
+func nextCount(for option: String, minimum: Int) -> Int {
+	guard let count = Int(nextArgument(for: option)), count >= minimum else { fail("Expected a count of at least \(minimum) for \(option).") }
+	return count
+}
+
+while let argument = arguments.next() {
+	switch argument {
+	case "--filter":
+		filter = nextArgument(for: argument)
+	case "--samples":
+		samples = nextCount(for: argument, minimum: 1)
+	case "--warmups":
+		warmups = nextCount(for: argument, minimum: 0)
+	case "--label":
+		label = nextArgument(for: argument)
+	case "--output":
+		outputPath = nextArgument(for: argument)
+	case "--allocations":
+		countsAllocations = true
+	case "--budgets":
+		budgetsPath = nextArgument(for: argument)
+		countsAllocations = true
+	case "--list":
+		listsBenchmarks = true
+	default:
+		fail("Unknown option \(argument).")
+	}
+}
+
+let selected = benchmarks.filter { benchmark in
+	filter.map { benchmark.identifier.contains($0) } ?? true
+}
+
+if listsBenchmarks {
+	selected.forEach { print($0.identifier) }
+	exit(0)
+}
+
+#if DEBUG
+let configuration = "debug"
+FileHandle.standardError.write("warning: Benchmarks are built in debug configuration. Use `-c release` for meaningful results.\n".data(using: .utf8)!)
+#else
+let configuration = "release"
+#endif
+
+#if os(Linux)
+let platform = "linux"
+#else
+let platform = "darwin"
+#endif
+
+let timestamp = Date().timeIntervalSince1970
+let runner = BenchmarkRunner(samples: samples, warmups: warmups, countsAllocations: countsAllocations)
+
+let results: [BenchmarkResult] = selected.map { benchmark in
+	FileHandle.standardError.write("Running \(benchmark.identifier)\n".data(using: .utf8)!)
+	return runner.measure(benchmark)
+}
+
+let report = BenchmarkReport(
+	label: label,
+	timestamp: timestamp,
+	configuration: configuration,
+	platform: platform,
+	samplesPerBenchmark: samples,
+	results: results
+)
+
+let encoder = JSONEncoder()
+encoder.outputFormatting = .prettyPrinted
+if #available(macOS 10.13, iOS 11.0, tvOS 11.0, watchOS 4.0, *) {
+	encoder.outputFormatting.insert(.sortedKeys)
+}
+
+let data: Data
+do {
+	data = try encoder.encode(report)
+} catch {
+	fail("Failed to encode the report: \(error)")
+}
+
+if let outputPath = outputPath {
+	do {
+		try data.write(to: URL(fileURLWithPath: outputPath))
+	} catch {
+		fail("Failed to write the report to \(outputPath): \(error)")
+	}
+} else {
+	FileHandle.standardOutput.write(data)
+	FileHandle.standardOutput.write("\n".data(using: .utf8)!)
+}
+
+if let budgetsPath = budgetsPath {
+	let budgets: [String: Double]
+	do {
+		budgets = try JSONDecoder().decode([String: Double].self, from: Data(contentsOf: URL(fileURLWithPath: budgetsPath)))
+	} catch {
+		fail("Failed to read the budgets from \(budgetsPath): \(error)")
+	}
+
+	var violations: [String] = []
+
+	for result in results {
+		guard let budget = budgets[result.identifier] else { continue }
+		guard let allocations = result.allocations?.allocationsPerOperation else {
+			fail("Allocations cannot be counted on this platform.")
+		}
+
+		if allocations > budget {
+			violations.append("\(result.identifier): \(allocations) allocations per operation exceed the budget of \(budget).")
+		}
+	}
+
+	if !violations.isEmpty {
+		fail(violations.joined(separator: "\n"))
+	}
+}
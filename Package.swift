@@ -15,6 +15,12 @@ let package = Package(
     ],
     targets: [
         .target(name: "ReactiveSwift", dependencies: [], path: "Sources"),
+        .target(
+            name: "CAllocationCounter",
+            path: "Benchmarks/CAllocationCounter",
+            linkerSettings: [.linkedLibrary("dl", .when(platforms: [.linux]))]
+        ),
+        .target(name: "ReactiveSwiftBenchmarks", dependencies: ["ReactiveSwift", "CAllocationCounter"], path: "Benchmarks/ReactiveSwiftBenchmarks"),
         .testTarget(name: "ReactiveSwiftTests", dependencies: ["ReactiveSwift", "Quick", "Nimble"]),
     ],
     swiftLanguageVersions: [.v5]
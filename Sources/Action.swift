@@ -15,16 +15,49 @@ import Foundation
 /// Specifically, the `execute` closure would be supplied with the latest state of
 /// `Action` and the external input from `apply()`.
 ///
-/// `Action` enforces serial execution, and disables the `Action` during the execution.
+/// By default, `Action` enforces serial execution, and disables the `Action` during the
+/// execution. An `Action` may instead be created with a limit of concurrent executions,
+/// and an `ActionOverflowPolicy` for applications beyond the limit.
 public final class Action<Input, Output, Error: Swift.Error> {
 	private struct ActionState<Value> {
 		var isEnabled: Bool {
-			return isUserEnabled && !isExecuting
+			return isUserEnabled && (executionCount < maximumConcurrentExecutions || overflowPolicy != .reject)
 		}
 
 		var isUserEnabled: Bool
-		var isExecuting: Bool
+		var executionCount: Int
 		var value: Value
+
+		/// The applications waiting for an execution slot, in the order of their
+		/// starts.
+		var pendingExecutions: [PendingExecution<Value>]
+
+		let maximumConcurrentExecutions: Int
+		let overflowPolicy: ActionOverflowPolicy
+	}
+
+	/// The decision made on an application of the `Action`.
+	private enum ApplicationDecision<Value> {
+		/// The application starts its unit of work with the given state.
+		case start(Value)
+
+		/// The application waits for an execution slot, and replaces the given
+		/// waiting application, if any.
+		case wait(replacing: PendingExecution<Value>?)
+
+		/// The application fails with `ActionError.disabled`.
+		case reject
+	}
+
+	/// An application of the `Action` waiting for an execution slot.
+	private final class PendingExecution<Value> {
+		let start: (Value) -> Void
+		let reject: () -> Void
+
+		init(start: @escaping (Value) -> Void, reject: @escaping () -> Void) {
+			self.start = start
+			self.reject = reject
+		}
 	}
 
 	private let execute: (Action<Input, Output, Error>, Input) -> SignalProducer<Output, ActionError<Error>>
@@ -66,6 +99,9 @@ public final class Action<Input, Output, Error: Swift.Error> {
 	/// Whether the action is currently executing.
 	public let isExecuting: Property<Bool>
 
+	/// The number of units of work the action is currently executing.
+	public let executionCount: Property<Int>
+
 	/// Whether the action is currently enabled.
 	public let isEnabled: Property<Bool>
 
@@ -91,7 +127,42 @@ public final class Action<Input, Output, Error: Swift.Error> {
 	///                given the latest `Action` state.
 	///   - execute: A closure that produces a unit of work, as `SignalProducer`, to be
 	///              executed by the `Action`.
-	public init<State: PropertyProtocol>(state: State, enabledIf isEnabled: @escaping (State.Value) -> Bool, execute: @escaping (State.Value, Input) -> SignalProducer<Output, Error>) {
+	public convenience init<State: PropertyProtocol>(state: State, enabledIf isEnabled: @escaping (State.Value) -> Bool, execute: @escaping (State.Value, Input) -> SignalProducer<Output, Error>) {
+		self.init(state: state, enabledIf: isEnabled, maximumConcurrentExecutions: 1, overflowPolicy: .reject, execute: execute)
+	}
+
+	/// Initializes an `Action` that would be conditionally enabled depending on its
+	/// state, and that executes up to the given number of units of work concurrently.
+	///
+	/// When all execution slots are in use, further applications are handled as
+	/// specified by `overflowPolicy`. A waiting application starts its unit of work
+	/// with the latest state once an execution slot is freed, or fails with
+	/// `ActionError.disabled` if the `Action` has been disabled by then.
+	///
+	/// - note: `Action` guarantees that changes to `state` are observed in a
+	///         thread-safe way. Thus, the value passed to `isEnabled` will
+	///         always be identical to the value passed to `execute`, for each
+	///         application of the action.
+	///
+	/// - parameters:
+	///   - state: A property to be the state of the `Action`.
+	///   - isEnabled: A predicate which determines the availability of the `Action`,
+	///                given the latest `Action` state.
+	///   - maximumConcurrentExecutions: The maximum number of units of work executing
+	///                                  concurrently. It must be positive.
+	///   - overflowPolicy: The policy for applications beyond
+	///                     `maximumConcurrentExecutions`.
+	///   - execute: A closure that produces a unit of work, as `SignalProducer`, to be
+	///              executed by the `Action`.
+	public init<State: PropertyProtocol>(
+		state: State,
+		enabledIf isEnabled: @escaping (State.Value) -> Bool,
+		maximumConcurrentExecutions: Int,
+		overflowPolicy: ActionOverflowPolicy,
+		execute: @escaping (State.Value, Input) -> SignalProducer<Output, Error>
+	) {
+		precondition(maximumConcurrentExecutions > 0, "An action must be able to execute at least one unit of work at a time.")
+
 		let isUserEnabled = isEnabled
 
 		(lifetime, deinitToken) = Lifetime.make()
@@ -106,29 +177,111 @@ public final class Action<Input, Output, Error: Swift.Error> {
 		errors = events.compactMap { $0.error }
 		completed = events.compactMap { $0.isCompleted ? () : nil }
 
-		let actionState = MutableProperty(ActionState<State.Value>(isUserEnabled: true, isExecuting: false, value: state.value))
+		// The action state is guarded by a plain lock, which is never held across any
+		// call-out. The derived properties are updated afterwards.
+		let stateLock = Lock.make("Action.stateLock")
+		var actionState = ActionState<State.Value>(
+			isUserEnabled: true,
+			executionCount: 0,
+			value: state.value,
+			pendingExecutions: [],
+			maximumConcurrentExecutions: maximumConcurrentExecutions,
+			overflowPolicy: overflowPolicy
+		)
+
+		func readActionState() -> ActionState<State.Value> {
+			stateLock.lock()
+			defer { stateLock.unlock() }
+			return actionState
+		}
 
-		// `isEnabled` and `isExecuting` have their own backing so that when the observers
-		// of these synchronously affects the action state, the signal of the action state
-		// does not deadlock due to the recursion.
+		// `isEnabled`, `isExecuting` and `executionCount` have their own backing so that
+		// when the observers of these synchronously affects the action state, the
+		// action state does not deadlock due to the recursion.
+		let executionCount = MutableProperty(0)
+		self.executionCount = Property(capturing: executionCount)
 		let isExecuting = MutableProperty(false)
 		self.isExecuting = Property(capturing: isExecuting)
-		let isEnabled = MutableProperty(actionState.value.isEnabled)
+		let isEnabled = MutableProperty(actionState.isEnabled)
 		self.isEnabled = Property(capturing: isEnabled)
 
-		func modifyActionState<Result>(_ action: (inout ActionState<State.Value>) throws -> Result) rethrows -> Result {
-			return try actionState.begin { storage in
-				let oldState = storage.value
-				defer {
-					let newState = storage.value
-					if oldState.isEnabled != newState.isEnabled {
-						isEnabled.value = newState.isEnabled
-					}
-					if oldState.isExecuting != newState.isExecuting {
-						isExecuting.value = newState.isExecuting
-					}
+		// Serializes the updates of the derived properties, so that they always
+		// settle with the latest action state. It is recursive, since the observers of
+		// these properties may apply the action synchronously.
+		let publishLock = Lock.makeRecursive("Action.publishLock")
+
+		// Guarded by `publishLock`.
+		var isPublishing = false
+		var needsPublishing = false
+
+		func publishActionState() {
+			publishLock.lock()
+			defer { publishLock.unlock() }
+
+			// If the observers of an update change the action state, the change is
+			// published by the outermost call, which starts over with the latest state.
+			needsPublishing = true
+			guard !isPublishing else { return }
+
+			isPublishing = true
+			defer { isPublishing = false }
+
+			while needsPublishing {
+				needsPublishing = false
+				let state = readActionState()
+
+				if isEnabled.value != state.isEnabled {
+					isEnabled.value = state.isEnabled
+					if needsPublishing { continue }
 				}
-				return try storage.modify(action)
+				if isExecuting.value != (state.executionCount > 0) {
+					isExecuting.value = state.executionCount > 0
+					if needsPublishing { continue }
+				}
+				if executionCount.value != state.executionCount {
+					executionCount.value = state.executionCount
+				}
+			}
+		}
+
+		func modifyActionState<Result>(_ action: (inout ActionState<State.Value>) -> Result) -> Result {
+			stateLock.lock()
+			let oldState = actionState
+			let result = action(&actionState)
+			let needsPublishing = oldState.isEnabled != actionState.isEnabled
+				|| oldState.executionCount != actionState.executionCount
+			stateLock.unlock()
+
+			if needsPublishing {
+				publishActionState()
+			}
+
+			return result
+		}
+
+		func executionDidEnd() {
+			let (next, rejected): ((PendingExecution<State.Value>, State.Value)?, [PendingExecution<State.Value>]) = modifyActionState { state in
+				state.executionCount -= 1
+
+				guard state.isUserEnabled else {
+					defer { state.pendingExecutions = [] }
+					return (nil, state.pendingExecutions)
+				}
+
+				guard !state.pendingExecutions.isEmpty else {
+					return (nil, [])
+				}
+
+				state.executionCount += 1
+				return ((state.pendingExecutions.removeFirst(), state.value), [])
+			}
+
+			for pending in rejected {
+				pending.reject()
+			}
+
+			if case let (pending, state)? = next {
+				pending.start(state)
 			}
 		}
 
@@ -141,29 +294,66 @@ public final class Action<Input, Output, Error: Swift.Error> {
 
 		self.execute = { action, input in
 			return SignalProducer { observer, lifetime in
-				let latestState: State.Value? = modifyActionState { state in
-					guard state.isEnabled else {
-						return nil
+				func start(_ state: State.Value) {
+					let interruptHandle = execute(state, input).start { event in
+						observer.send(event.mapError(ActionError.producerFailed))
+						action.eventsObserver.send(value: event)
 					}
 
-					state.isExecuting = true
-					return state.value
+					lifetime.observeEnded {
+						interruptHandle.dispose()
+						executionDidEnd()
+					}
 				}
 
-				guard let state = latestState else {
+				func reject() {
 					observer.send(error: .disabled)
 					action.disabledErrorsObserver.send(value: ())
-					return
 				}
 
-				let interruptHandle = execute(state, input).start { event in
-					observer.send(event.mapError(ActionError.producerFailed))
-					action.eventsObserver.send(value: event)
+				let pending = PendingExecution<State.Value>(start: start, reject: reject)
+
+				let decision: ApplicationDecision<State.Value> = modifyActionState { state in
+					guard state.isUserEnabled else {
+						return .reject
+					}
+
+					if state.executionCount < state.maximumConcurrentExecutions {
+						state.executionCount += 1
+						return .start(state.value)
+					}
+
+					switch state.overflowPolicy {
+					case .reject:
+						return .reject
+
+					case .enqueue:
+						state.pendingExecutions.append(pending)
+						return .wait(replacing: nil)
+
+					case .enqueueLatest:
+						let replaced = state.pendingExecutions.first
+						state.pendingExecutions = [pending]
+						return .wait(replacing: replaced)
+					}
 				}
 
-				lifetime.observeEnded {
-					interruptHandle.dispose()
-					modifyActionState { $0.isExecuting = false }
+				switch decision {
+				case let .start(state):
+					start(state)
+
+				case let .wait(replaced):
+					replaced?.reject()
+
+					// An application interrupted while waiting leaves the queue.
+					lifetime.observeEnded {
+						modifyActionState { state in
+							state.pendingExecutions.removeAll { $0 === pending }
+						}
+					}
+
+				case .reject:
+					reject()
 				}
 			}
 		}
@@ -346,6 +536,21 @@ extension Action where Input == Void {
 	}
 }
 
+/// `ActionOverflowPolicy` determines how an `Action` handles applications while all its
+/// execution slots are in use.
+public enum ActionOverflowPolicy {
+	/// The application fails with `ActionError.disabled`.
+	case reject
+
+	/// The application waits for an execution slot. Waiting applications start in the
+	/// order they are applied.
+	case enqueue
+
+	/// The application waits for an execution slot, and replaces any application that
+	/// is already waiting. The replaced application fails with `ActionError.disabled`.
+	case enqueueLatest
+}
+
 /// `ActionError` represents the error that could be emitted by a unit of work of a
 /// certain `Action`.
 public enum ActionError<Error: Swift.Error>: Swift.Error {
@@ -102,6 +102,74 @@ internal struct UnsafeAtomicState<State: RawRepresentable> where State.RawValue
 #endif
 }
 
+/// An integer which is written rarely and read on hot paths, e.g. the switch of an
+/// opt-in diagnostic.
+internal final class AtomicInt32 {
+#if os(macOS) || os(iOS) || os(tvOS) || os(watchOS)
+	private let value: UnsafeMutablePointer<Int32>
+
+	/// Create an atomic integer with the specified initial value.
+	///
+	/// - parameters:
+	///   - initial: The initial value.
+	internal init(_ initial: Int32) {
+		value = UnsafeMutablePointer<Int32>.allocate(capacity: 1)
+		value.initialize(to: initial)
+	}
+
+	deinit {
+		value.deinitialize(count: 1)
+		value.deallocate()
+	}
+
+	/// Load the value. The load is atomic, but implies no memory barrier.
+	internal func load() -> Int32 {
+		return OSAtomicAdd32(0, value)
+	}
+
+	/// Store the value, with a full memory barrier.
+	///
+	/// - parameters:
+	///   - newValue: The new value.
+	internal func store(_ newValue: Int32) {
+		var current = load()
+		while !OSAtomicCompareAndSwap32Barrier(current, newValue, value) {
+			current = load()
+		}
+	}
+#else
+	// The lock is created directly, since `Lock.make` reads the switch of
+	// `LockChecking`.
+	private let lock = Lock.PthreadLock()
+	private var value: Int32
+
+	/// Create an atomic integer with the specified initial value.
+	///
+	/// - parameters:
+	///   - initial: The initial value.
+	internal init(_ initial: Int32) {
+		value = initial
+	}
+
+	/// Load the value.
+	internal func load() -> Int32 {
+		lock.lock()
+		defer { lock.unlock() }
+		return value
+	}
+
+	/// Store the value.
+	///
+	/// - parameters:
+	///   - newValue: The new value.
+	internal func store(_ newValue: Int32) {
+		lock.lock()
+		value = newValue
+		lock.unlock()
+	}
+#endif
+}
+
 /// `Lock` exposes `os_unfair_lock` on supported platforms, with pthread mutex as the
 /// fallback.
 internal class Lock {
@@ -131,6 +199,10 @@ internal class Lock {
 			return os_unfair_lock_trylock(_lock)
 		}
 
+		override var estimatedFootprint: Int {
+			return MemoryEstimate.object(storedBytes: MemoryLayout<os_unfair_lock_t>.size) + MemoryEstimate.object(storedBytes: MemoryLayout<os_unfair_lock>.size)
+		}
+
 		deinit {
 			_lock.deinitialize(count: 1)
 			_lock.deallocate()
@@ -195,7 +267,65 @@ internal class Lock {
 		}
 	}
 
-	static func make() -> Lock {
+	/// A lock which checks its acquisitions through `LockChecking`.
+	internal final class CheckedLock: Lock {
+		let name: StaticString
+		let isRecursive: Bool
+		private let base: Lock
+
+		init(_ base: Lock, name: StaticString, isRecursive: Bool) {
+			self.base = base
+			self.name = name
+			self.isRecursive = isRecursive
+			super.init()
+		}
+
+		override func lock() {
+			LockChecking.willAcquire(self)
+			base.lock()
+			LockChecking.didAcquire(self)
+		}
+
+		override func unlock() {
+			LockChecking.willRelease(self)
+			base.unlock()
+		}
+
+		override func `try`() -> Bool {
+			// A failed attempt cannot block, so only successful attempts are recorded.
+			guard base.try() else { return false }
+			LockChecking.didAcquire(self)
+			return true
+		}
+
+		override var estimatedFootprint: Int {
+			return MemoryEstimate.object(storedBytes: MemoryLayout<(StaticString, Bool, Lock)>.size) + base.estimatedFootprint
+		}
+
+		deinit {
+			LockChecking.lockDidDeinitialize(self)
+		}
+	}
+
+	/// Make a non-recursive lock.
+	///
+	/// - parameters:
+	///   - name: The name of the lock in the reports of `LockChecking`.
+	static func make(_ name: StaticString = "Lock") -> Lock {
+		let lock = makeUnchecked()
+		return LockChecking.isEnabled ? CheckedLock(lock, name: name, isRecursive: false) : lock
+	}
+
+	/// Make a recursive lock.
+	///
+	/// - parameters:
+	///   - name: The name of the lock in the reports of `LockChecking`.
+	static func makeRecursive(_ name: StaticString = "Lock") -> Lock {
+		let lock = PthreadLock(recursive: true)
+		return LockChecking.isEnabled ? CheckedLock(lock, name: name, isRecursive: true) : lock
+	}
+
+	private static func makeUnchecked() -> Lock {
 		#if os(macOS) || os(iOS) || os(tvOS) || os(watchOS)
 		if #available(*, iOS 10.0, macOS 10.12, tvOS 10.0, watchOS 3.0) {
 			return UnfairLock()
@@ -210,6 +340,13 @@ internal class Lock {
 	func lock() { fatalError() }
 	func unlock() { fatalError() }
 	func `try`() -> Bool { fatalError() }
+
+	/// The estimated bytes held by the lock, which defaults to the footprint of a
+	/// `PthreadLock`, i.e. the largest of the platform locks.
+	var estimatedFootprint: Int {
+		return MemoryEstimate.object(storedBytes: MemoryLayout<UnsafeMutablePointer<pthread_mutex_t>>.size)
+			+ MemoryEstimate.object(storedBytes: MemoryLayout<pthread_mutex_t>.size)
+	}
 }
 
 /// An atomic variable.
@@ -234,7 +371,7 @@ public final class Atomic<Value> {
 	///   - value: Initial value for `self`.
 	public init(_ value: Value) {
 		_value = value
-		lock = Lock.make()
+		lock = Lock.make("Atomic.lock")
 	}
 
 	/// Atomically modifies the variable.
@@ -266,6 +403,12 @@ public final class Atomic<Value> {
 		return try action(_value)
 	}
 
+	/// The estimated bytes held by the variable, excluding the buffers referenced by
+	/// the value.
+	internal var estimatedFootprint: Int {
+		return MemoryEstimate.object(storedBytes: MemoryLayout<(Lock, Value)>.size) + lock.estimatedFootprint
+	}
+
 	/// Atomically replace the contents of the variable.
 	///
 	/// - parameters:
@@ -31,6 +31,11 @@ public struct Bag<Element> {
 		self.tokens = ContiguousArray(0..<nextToken.value)
 	}
 
+	/// The estimated bytes of the buffers held by `self`.
+	internal var estimatedFootprint: Int {
+		return MemoryEstimate.array(elements) + MemoryEstimate.array(tokens)
+	}
+
 	/// Insert the given value into `self`, and return a token that can
 	/// later be passed to `remove(using:)`.
 	///
@@ -58,7 +63,7 @@ public struct Bag<Element> {
 	///   - token: A token returned from a call to `insert()`.
 	@discardableResult
 	public mutating func remove(using token: Token) -> Element? {
-		guard let index = indices.first(where: { tokens[$0] == token.value }) else {
+		guard let index = tokens.index(ofToken: token) else {
 			return nil
 		}
 
@@ -97,3 +102,140 @@ extension Bag: RandomAccessCollection {
 		}
 	}
 }
+
+/// The observer storage of `Signal`, which behaves like `Bag`, except that removal
+/// does not shift the elements after the removed one.
+///
+/// A removed element leaves a `nil` tombstone. The tombstones are compacted once
+/// they outnumber the elements, which keeps removal amortized O(1) besides the
+/// search of the token.
+internal struct ObserverBag<Element>: Sequence {
+	typealias Token = Bag<Element>.Token
+
+	/// The elements in the order of insertion, including the tombstones.
+	private var elements: ContiguousArray<Element?>
+	private var tokens: ContiguousArray<UInt64>
+
+	/// The number of tombstones in `elements`.
+	private var tombstones: Int
+
+	private var nextToken: Token
+
+	init() {
+		elements = ContiguousArray()
+		tokens = ContiguousArray()
+		tombstones = 0
+		nextToken = Token(value: 0)
+	}
+
+	/// The number of elements, excluding the tombstones.
+	var count: Int {
+		return elements.count - tombstones
+	}
+
+	var isEmpty: Bool {
+		return count == 0
+	}
+
+	/// The estimated bytes of the buffers held by `self`.
+	var estimatedFootprint: Int {
+		return MemoryEstimate.array(elements) + MemoryEstimate.array(tokens)
+	}
+
+	/// Insert the given value into `self`, and return a token that can later be
+	/// passed to `remove(using:)`.
+	///
+	/// - parameters:
+	///   - value: A value that will be inserted.
+	@discardableResult
+	mutating func insert(_ value: Element) -> Token {
+		let token = nextToken
+		nextToken = Token(value: token.value &+ 1)
+
+		elements.append(value)
+		tokens.append(token.value)
+
+		return token
+	}
+
+	/// Remove a value, given the token returned from `insert()`.
+	///
+	/// - note: If the value has already been removed, nothing happens.
+	///
+	/// - parameters:
+	///   - token: A token returned from a call to `insert()`.
+	@discardableResult
+	mutating func remove(using token: Token) -> Element? {
+		guard let index = tokens.index(ofToken: token), let element = elements[index] else {
+			return nil
+		}
+
+		elements[index] = nil
+		tombstones += 1
+
+		if tombstones * 2 > elements.count {
+			compact()
+		}
+
+		return element
+	}
+
+	/// Remove the tombstones, preserving the order of the elements.
+	private mutating func compact() {
+		var target = elements.startIndex
+
+		for source in elements.indices where elements[source] != nil {
+			elements.swapAt(target, source)
+			tokens.swapAt(target, source)
+			target += 1
+		}
+
+		elements.removeSubrange(target...)
+		tokens.removeSubrange(target...)
+		tombstones = 0
+	}
+
+	func makeIterator() -> Iterator {
+		return Iterator(elements.makeIterator())
+	}
+
+	/// An iterator of `ObserverBag`, which skips the tombstones.
+	struct Iterator: IteratorProtocol {
+		private var base: ContiguousArray<Element?>.Iterator
+
+		fileprivate init(_ base: ContiguousArray<Element?>.Iterator) {
+			self.base = base
+		}
+
+		mutating func next() -> Element? {
+			while let element = base.next() {
+				if let element = element {
+					return element
+				}
+			}
+			return nil
+		}
+	}
+}
+
+extension ContiguousArray where Element == UInt64 {
+	/// The index of the given token, located by a binary search.
+	///
+	/// - note: The tokens of a bag are always in ascending order, since tokens are
+	///         issued in ascending order and are appended upon insertion.
+	fileprivate func index<Value>(ofToken token: Bag<Value>.Token) -> Int? {
+		var low = startIndex
+		var high = endIndex
+
+		while low < high {
+			let middle = low + (high - low) / 2
+			if self[middle] < token.value {
+				low = middle + 1
+			} else {
+				high = middle
+			}
+		}
+
+		return low < endIndex && self[low] == token.value ? low : nil
+	}
+}
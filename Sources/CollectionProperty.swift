@@ -0,0 +1,750 @@
+/// A change to an ordered collection.
+///
+/// Changes are delivered in batches, in which every change is relative to the
+/// collection resulting from the changes preceding it in the batch.
+public enum CollectionChange<Element> {
+	/// The collection has been replaced with the given elements.
+	case reset([Element])
+
+	/// An element has been inserted at the given index.
+	case insert(Element, at: Int)
+
+	/// The element at the given index has been removed.
+	case remove(at: Int)
+
+	/// The element at the given index has been replaced by the given element.
+	case update(Element, at: Int)
+
+	/// The element at `from` has been removed, and then inserted at `to`.
+	case move(from: Int, to: Int)
+
+	/// Map the elements carried by the change.
+	///
+	/// - parameters:
+	///   - transform: A closure that maps an element.
+	///
+	/// - returns: A change with the mapped elements at the same indices.
+	internal func map<U>(_ transform: (Element) -> U) -> CollectionChange<U> {
+		switch self {
+		case let .reset(elements):
+			return .reset(elements.map(transform))
+		case let .insert(element, index):
+			return .insert(transform(element), at: index)
+		case let .remove(index):
+			return .remove(at: index)
+		case let .update(element, index):
+			return .update(transform(element), at: index)
+		case let .move(source, destination):
+			return .move(from: source, to: destination)
+		}
+	}
+
+	/// Apply the change to the given collection.
+	///
+	/// - parameters:
+	///   - elements: The collection to be modified.
+	internal func apply(to elements: inout [Element]) {
+		switch self {
+		case let .reset(newElements):
+			elements = newElements
+		case let .insert(element, index):
+			elements.insert(element, at: index)
+		case let .remove(index):
+			elements.remove(at: index)
+		case let .update(element, index):
+			elements[index] = element
+		case let .move(source, destination):
+			elements.insert(elements.remove(at: source), at: destination)
+		}
+	}
+}
+
+extension CollectionChange: Equatable where Element: Equatable {}
+
+/// Represents a property of an ordered collection, which describes its changes
+/// in terms of `CollectionChange`s in addition to its values.
+public protocol CollectionPropertyProtocol: PropertyProtocol where Value == [Element] {
+	/// The type of elements of the collection.
+	associatedtype Element
+
+	/// The changes producer of the property.
+	///
+	/// It produces a signal that sends a `reset` to the property's current value,
+	/// followed by all changes over time. It completes when the property has
+	/// deinitialized, or has no further change.
+	var changes: SignalProducer<[CollectionChange<Element>], Never> { get }
+}
+
+/// A mutable property of an ordered collection, which describes its changes in
+/// terms of `CollectionChange`s.
+///
+/// Unlike a `MutableProperty` of an array, it allows consumers to process only the
+/// elements affected by a change through its `changes` producer, and the
+/// incremental operators, e.g. `mapElements(_:)`, built upon it.
+///
+/// Instances of this class are thread-safe.
+public final class MutableCollectionProperty<Element>: MutablePropertyProtocol, CollectionPropertyProtocol {
+	private let token: Lifetime.Token
+	private let observer: Signal<[CollectionChange<Element>], Never>.Observer
+	private let box: PropertyBox<[Element]>
+
+	/// A signal that sends the changes of the property over time, then completes
+	/// when the property has deinitialized.
+	private let relay: Signal<[CollectionChange<Element>], Never>
+
+	/// The current value of the property.
+	///
+	/// Setting this to a new value will notify all observers with a `reset`.
+	public var value: [Element] {
+		get { return box.value }
+		set { modify { $0.removeAll(replacingWith: newValue) } }
+	}
+
+	/// The lifetime of the property.
+	public let lifetime: Lifetime
+
+	/// A signal that will send the property's changes over time,
+	/// then complete when the property has deinitialized.
+	public let signal: Signal<[Element], Never>
+
+	/// A producer for Signals that will send the property's current value,
+	/// followed by all changes over time, then complete when the property has
+	/// deinitialized.
+	public var producer: SignalProducer<[Element], Never> {
+		return SignalProducer { [box, relay] observer, lifetime in
+			box.withValue { elements in
+				observer.send(value: elements)
+				lifetime += relay
+					.map { _ in box.value }
+					.observe(Signal.Observer(mappingInterruptedToCompleted: observer))
+			}
+		}
+	}
+
+	/// A producer for Signals that will send a `reset` to the property's current
+	/// value, followed by all changes over time, then complete when the property
+	/// has deinitialized.
+	public var changes: SignalProducer<[CollectionChange<Element>], Never> {
+		return SignalProducer { [box, relay] observer, lifetime in
+			box.withValue { elements in
+				observer.send(value: [.reset(elements)])
+				lifetime += relay.observe(Signal.Observer(mappingInterruptedToCompleted: observer))
+			}
+		}
+	}
+
+	/// Initializes a mutable collection property that first takes on
+	/// `initialElements`.
+	///
+	/// - parameters:
+	///   - initialElements: Starting elements of the property.
+	public init(_ initialElements: [Element] = []) {
+		(relay, observer) = Signal.pipe()
+		(lifetime, token) = Lifetime.make()
+
+		let box = PropertyBox(initialElements)
+		self.box = box
+		signal = relay.map { _ in box.value }
+	}
+
+	/// Atomically modifies the collection. All changes made by `action` are sent
+	/// as one batch after `action` returns.
+	///
+	/// - parameters:
+	///   - action: A closure that accepts an editor of the collection.
+	///
+	/// - returns: The result of the action.
+	@discardableResult
+	public func modify<Result>(_ action: (inout CollectionEditor<Element>) throws -> Result) rethrows -> Result {
+		return try box.begin { storage in
+			var editor = CollectionEditor<Element>()
+
+			defer {
+				if !editor.changes.isEmpty {
+					observer.send(value: editor.changes)
+				}
+			}
+
+			return try storage.modify { elements in
+				// Move the storage into the editor, so that it can be mutated in place.
+				// `storage.modify` has moved it out of the box, so it is not shared.
+				Swift.swap(&elements, &editor.elements)
+				defer { Swift.swap(&elements, &editor.elements) }
+				return try action(&editor)
+			}
+		}
+	}
+
+	/// Append the given element to the collection.
+	///
+	/// - parameters:
+	///   - element: The element to append.
+	public func append(_ element: Element) {
+		modify { $0.append(element) }
+	}
+
+	/// Insert the given element at the given index.
+	///
+	/// - parameters:
+	///   - element: The element to insert.
+	///   - index: The index at which the element is inserted.
+	public func insert(_ element: Element, at index: Int) {
+		modify { $0.insert(element, at: index) }
+	}
+
+	/// Remove the element at the given index.
+	///
+	/// - parameters:
+	///   - index: The index of the element to remove.
+	///
+	/// - returns: The removed element.
+	@discardableResult
+	public func remove(at index: Int) -> Element {
+		return modify { $0.remove(at: index) }
+	}
+
+	/// Replace the element at the given index.
+	///
+	/// - parameters:
+	///   - element: The new element.
+	///   - index: The index of the element to replace.
+	public func update(_ element: Element, at index: Int) {
+		modify { $0.update(element, at: index) }
+	}
+
+	/// Move the element at `source` to `destination`.
+	///
+	/// - parameters:
+	///   - source: The index of the element to move.
+	///   - destination: The index of the element after the move.
+	public func move(from source: Int, to destination: Int) {
+		modify { $0.move(from: source, to: destination) }
+	}
+
+	deinit {
+		observer.sendCompleted()
+	}
+}
+
+/// An editor of the collection of a `MutableCollectionProperty`, which records the
+/// changes being made.
+public struct CollectionEditor<Element> {
+	/// The elements of the collection.
+	public fileprivate(set) var elements: [Element]
+
+	/// The changes made through the editor.
+	fileprivate private(set) var changes: [CollectionChange<Element>]
+
+	fileprivate init() {
+		elements = []
+		changes = []
+	}
+
+	private mutating func apply(_ change: CollectionChange<Element>) {
+		change.apply(to: &elements)
+		changes.append(change)
+	}
+
+	/// Append the given element to the collection.
+	///
+	/// - parameters:
+	///   - element: The element to append.
+	public mutating func append(_ element: Element) {
+		apply(.insert(element, at: elements.count))
+	}
+
+	/// Insert the given element at the given index.
+	///
+	/// - parameters:
+	///   - element: The element to insert.
+	///   - index: The index at which the element is inserted.
+	public mutating func insert(_ element: Element, at index: Int) {
+		apply(.insert(element, at: index))
+	}
+
+	/// Remove the element at the given index.
+	///
+	/// - parameters:
+	///   - index: The index of the element to remove.
+	///
+	/// - returns: The removed element.
+	@discardableResult
+	public mutating func remove(at index: Int) -> Element {
+		let element = elements[index]
+		apply(.remove(at: index))
+		return element
+	}
+
+	/// Replace the element at the given index.
+	///
+	/// - parameters:
+	///   - element: The new element.
+	///   - index: The index of the element to replace.
+	public mutating func update(_ element: Element, at index: Int) {
+		apply(.update(element, at: index))
+	}
+
+	/// Move the element at `source` to `destination`.
+	///
+	/// - parameters:
+	///   - source: The index of the element to move.
+	///   - destination: The index of the element after the move.
+	public mutating func move(from source: Int, to destination: Int) {
+		apply(.move(from: source, to: destination))
+	}
+
+	/// Replace all elements of the collection.
+	///
+	/// - parameters:
+	///   - newElements: The new elements of the collection.
+	public mutating func removeAll(replacingWith newElements: [Element] = []) {
+		apply(.reset(newElements))
+	}
+}
+
+/// A read-only property of an ordered collection, which is derived incrementally
+/// from the changes of its source.
+///
+/// Like a composed `Property`, it does not own its lifetime, and its producers and
+/// signal are bound to the lifetime of its source.
+public final class CollectionProperty<Element>: CollectionPropertyProtocol {
+	private let box: PropertyBox<[Element]?>
+	private let relay: Signal<[CollectionChange<Element>], Never>
+
+	/// The current value of the property.
+	public var value: [Element] {
+		return box.value!
+	}
+
+	/// A signal that will send the property's changes over time, then complete
+	/// when its source has deinitialized or has no further changes.
+	public let signal: Signal<[Element], Never>
+
+	/// A producer for Signals that will send the property's current value,
+	/// followed by all changes over time, then complete when its source has
+	/// deinitialized or has no further changes.
+	public var producer: SignalProducer<[Element], Never> {
+		return SignalProducer { [box, relay] observer, lifetime in
+			box.withValue { elements in
+				observer.send(value: elements!)
+				lifetime += relay
+					.map { _ in box.value! }
+					.observe(Signal.Observer(mappingInterruptedToCompleted: observer))
+			}
+		}
+	}
+
+	/// A producer for Signals that will send a `reset` to the property's current
+	/// value, followed by all changes over time, then complete when its source
+	/// has deinitialized or has no further changes.
+	public var changes: SignalProducer<[CollectionChange<Element>], Never> {
+		return SignalProducer { [box, relay] observer, lifetime in
+			box.withValue { elements in
+				observer.send(value: [.reset(elements!)])
+				lifetime += relay.observe(Signal.Observer(mappingInterruptedToCompleted: observer))
+			}
+		}
+	}
+
+	/// Initialize a collection property from a producer of changes that promises to
+	/// send a batch starting with a `reset` synchronously in its start handler
+	/// before sending any subsequent event.
+	///
+	/// - warning: If the producer fails its promise, a fatal error would be
+	///            raised.
+	///
+	/// - parameters:
+	///   - unsafeChanges: The producer of changes.
+	fileprivate init(unsafeChanges: SignalProducer<[CollectionChange<Element>], Never>) {
+		// The ownership graph is identical to the one of a composed `Property`.
+		let box = PropertyBox<[Element]?>(nil)
+
+		let disposable = SerialDisposable()
+		let (relay, observer) = Signal<[CollectionChange<Element>], Never>.pipe(disposable: disposable)
+
+		disposable.inner = unsafeChanges.start { [weak box] event in
+			guard let box = box else {
+				return observer.send(event)
+			}
+
+			box.begin { storage in
+				if let changes = event.value {
+					storage.modify { elements in
+						for change in changes {
+							if case let .reset(newElements) = change {
+								elements = newElements
+							} else {
+								change.apply(to: &elements!)
+							}
+						}
+					}
+				}
+				observer.send(event)
+			}
+		}
+
+		// Verify that an initial is sent. This is friendlier than deadlocking
+		// in the event that one isn't.
+		guard box.value != nil else {
+			fatalError("The producer promised to send a reset. Received none.")
+		}
+
+		self.box = box
+		self.relay = relay
+		signal = relay.map { _ in box.value! }
+	}
+}
+
+extension CollectionPropertyProtocol {
+	/// Lifts an incremental transformation of changes to operate upon
+	/// `CollectionPropertyProtocol`.
+	///
+	/// - parameters:
+	///   - makeTransform: A closure creating the transformation for each start of
+	///                    `changes`, so that it may carry its own state.
+	///
+	/// - returns: A collection property derived from `self`.
+	fileprivate func lift<U>(_ makeTransform: @escaping () -> ([CollectionChange<Element>]) -> [CollectionChange<U>]) -> CollectionProperty<U> {
+		let changes = self.changes
+		return CollectionProperty(unsafeChanges: SignalProducer { observer, lifetime in
+			let transform = makeTransform()
+			lifetime += changes.start { event in
+				guard case let .value(changes) = event else {
+					return observer.send(event.map(transform))
+				}
+
+				// Suppress the batches which have no effect on the derived collection.
+				let output = transform(changes)
+				if !output.isEmpty {
+					observer.send(value: output)
+				}
+			}
+		})
+	}
+
+	/// Maps the elements of the collection incrementally.
+	///
+	/// `transform` is applied only to the elements being inserted or updated.
+	///
+	/// - parameters:
+	///   - transform: A closure that maps an element of `self`.
+	///
+	/// - returns: A collection property of the mapped elements.
+	public func mapElements<U>(_ transform: @escaping (Element) -> U) -> CollectionProperty<U> {
+		return lift {
+			return { changes in changes.map { $0.map(transform) } }
+		}
+	}
+
+	/// Filters the elements of the collection incrementally.
+	///
+	/// `isIncluded` is evaluated only for the elements being inserted or updated.
+	/// Locating a changed element in the filtered collection takes O(log n).
+	/// Inserting or removing an element other than the last one takes O(n), like
+	/// it does for the arrays of the collections.
+	///
+	/// - parameters:
+	///   - isIncluded: A closure that determines whether an element should be
+	///                 included.
+	///
+	/// - returns: A collection property of the included elements.
+	public func filterElements(_ isIncluded: @escaping (Element) -> Bool) -> CollectionProperty<Element> {
+		return lift {
+			let state = FilterElementsState(isIncluded)
+			return state.transform
+		}
+	}
+
+	/// Sorts the elements of the collection incrementally.
+	///
+	/// Each change is resolved with binary searches in the sorted collection, so
+	/// `areInIncreasingOrder` is evaluated O(log n) times per changed element.
+	///
+	/// - note: The relative order of equivalent elements is not guaranteed to
+	///         match their order in `self`.
+	///
+	/// - note: The operator retains a copy of the elements of `self`, in addition to
+	///         the sorted elements.
+	///
+	/// - parameters:
+	///   - areInIncreasingOrder: A predicate that returns `true` if its first
+	///                           argument should be ordered before its second
+	///                           argument.
+	///
+	/// - returns: A collection property of the sorted elements.
+	public func sortedElements(by areInIncreasingOrder: @escaping (Element, Element) -> Bool) -> CollectionProperty<Element> {
+		return lift {
+			let state = SortElementsState(areInIncreasingOrder)
+			return state.transform
+		}
+	}
+}
+
+extension CollectionPropertyProtocol where Element: Comparable {
+	/// Sorts the elements of the collection incrementally in ascending order.
+	///
+	/// - returns: A collection property of the sorted elements.
+	public func sortedElements() -> CollectionProperty<Element> {
+		return sortedElements(by: <)
+	}
+}
+
+/// The state of `filterElements(_:)`.
+private final class FilterElementsState<Element> {
+	private let isIncluded: (Element) -> Bool
+
+	/// Whether each element of the source is included.
+	private var inclusions = InclusionCounts()
+
+	init(_ isIncluded: @escaping (Element) -> Bool) {
+		self.isIncluded = isIncluded
+	}
+
+	/// The index in the filtered collection of the source element at `index`.
+	private func filteredIndex(_ index: Int) -> Int {
+		return inclusions.count(before: index)
+	}
+
+	func transform(_ changes: [CollectionChange<Element>]) -> [CollectionChange<Element>] {
+		var output: [CollectionChange<Element>] = []
+
+		for change in changes {
+			switch change {
+			case let .reset(elements):
+				let included = elements.map(isIncluded)
+				inclusions = InclusionCounts(included)
+				output.append(.reset(zip(elements, included).filter { $0.1 }.map { $0.0 }))
+
+			case let .insert(element, index):
+				let included = isIncluded(element)
+				if included {
+					output.append(.insert(element, at: filteredIndex(index)))
+				}
+				inclusions.insert(included, at: index)
+
+			case let .remove(index):
+				if inclusions[index] {
+					output.append(.remove(at: filteredIndex(index)))
+				}
+				inclusions.remove(at: index)
+
+			case let .update(element, index):
+				let included = isIncluded(element)
+				switch (inclusions[index], included) {
+				case (true, true):
+					output.append(.update(element, at: filteredIndex(index)))
+				case (true, false):
+					output.append(.remove(at: filteredIndex(index)))
+				case (false, true):
+					output.append(.insert(element, at: filteredIndex(index)))
+				case (false, false):
+					break
+				}
+				inclusions.set(included, at: index)
+
+			case let .move(source, destination):
+				let included = inclusions[source]
+				let filteredSource = filteredIndex(source)
+				inclusions.move(from: source, to: destination)
+
+				if included {
+					let filteredDestination = filteredIndex(destination)
+					if filteredSource != filteredDestination {
+						output.append(.move(from: filteredSource, to: filteredDestination))
+					}
+				}
+			}
+		}
+
+		return output
+	}
+}
+
+/// The inclusions of the source elements in `filterElements(_:)`, backed by a
+/// binary indexed tree, which counts the included elements before an index in
+/// O(log n).
+///
+/// Updating an inclusion, and appending or removing the last one, takes O(log n).
+/// Inserting or removing an inclusion elsewhere rebuilds the tree in O(n), which
+/// matches the cost of shifting the elements of the collections.
+private struct InclusionCounts {
+	private var inclusions: [Bool]
+
+	/// The node at `offset` counts the inclusions in the range ending at `offset`,
+	/// whose length is the lowest set bit of `offset + 1`.
+	private var tree: [Int]
+
+	init(_ inclusions: [Bool] = []) {
+		self.inclusions = inclusions
+		self.tree = []
+		rebuild()
+	}
+
+	subscript(index: Int) -> Bool {
+		return inclusions[index]
+	}
+
+	/// The number of inclusions before `index`.
+	func count(before index: Int) -> Int {
+		var count = 0
+		var node = index
+		while node > 0 {
+			count += tree[node - 1]
+			node &= node - 1
+		}
+		return count
+	}
+
+	mutating func set(_ isIncluded: Bool, at index: Int) {
+		guard inclusions[index] != isIncluded else { return }
+		inclusions[index] = isIncluded
+
+		let delta = isIncluded ? 1 : -1
+		var node = index + 1
+		while node <= tree.count {
+			tree[node - 1] += delta
+			node += node & -node
+		}
+	}
+
+	mutating func insert(_ isIncluded: Bool, at index: Int) {
+		guard index == inclusions.count else {
+			inclusions.insert(isIncluded, at: index)
+			return rebuild()
+		}
+
+		let node = index + 1
+		inclusions.append(isIncluded)
+		tree.append((isIncluded ? 1 : 0) + count(before: index) - count(before: node - (node & -node)))
+	}
+
+	mutating func remove(at index: Int) {
+		inclusions.remove(at: index)
+
+		if index == tree.count - 1 {
+			tree.removeLast()
+		} else {
+			rebuild()
+		}
+	}
+
+	mutating func move(from source: Int, to destination: Int) {
+		inclusions.insert(inclusions.remove(at: source), at: destination)
+		rebuild()
+	}
+
+	private mutating func rebuild() {
+		tree = inclusions.map { $0 ? 1 : 0 }
+
+		for node in stride(from: 1, through: tree.count, by: 1) {
+			let parent = node + (node & -node)
+			if parent <= tree.count {
+				tree[parent - 1] += tree[node - 1]
+			}
+		}
+	}
+}
+
+/// The state of `sortedElements(by:)`.
+private final class SortElementsState<Element> {
+	private let areInIncreasingOrder: (Element, Element) -> Bool
+
+	/// The elements of the source by the identifiers assigned to them.
+	private var elements: [UInt64: Element] = [:]
+
+	/// The identifiers of the source elements, in the order of the source, and in
+	/// the sorted order.
+	private var identifiers: [UInt64] = []
+	private var sorted: [UInt64] = []
+
+	private var nextIdentifier: UInt64 = 0
+
+	init(_ areInIncreasingOrder: @escaping (Element, Element) -> Bool) {
+		self.areInIncreasingOrder = areInIncreasingOrder
+	}
+
+	private func makeIdentifier() -> UInt64 {
+		defer { nextIdentifier &+= 1 }
+		return nextIdentifier
+	}
+
+	/// Whether the element identified by `left` is ordered before the one identified
+	/// by `right`. Equivalent elements are ordered by their identifiers, so that
+	/// every element has a unique sorted index.
+	private func precedes(_ left: UInt64, _ right: UInt64) -> Bool {
+		let leftElement = elements[left]!
+		let rightElement = elements[right]!
+
+		if areInIncreasingOrder(leftElement, rightElement) {
+			return true
+		}
+		if areInIncreasingOrder(rightElement, leftElement) {
+			return false
+		}
+		return left < right
+	}
+
+	/// The index of the first sorted element not ordered before the element
+	/// identified by `identifier`.
+	private func sortedIndex(of identifier: UInt64) -> Int {
+		var low = 0
+		var high = sorted.count
+		while low < high {
+			let middle = low + (high - low) / 2
+			if precedes(sorted[middle], identifier) {
+				low = middle + 1
+			} else {
+				high = middle
+			}
+		}
+		return low
+	}
+
+	func transform(_ changes: [CollectionChange<Element>]) -> [CollectionChange<Element>] {
+		var output: [CollectionChange<Element>] = []
+
+		for change in changes {
+			switch change {
+			case let .reset(newElements):
+				identifiers = newElements.map { _ in makeIdentifier() }
+				elements = Dictionary(uniqueKeysWithValues: zip(identifiers, newElements))
+				sorted = identifiers.sorted(by: precedes)
+				output.append(.reset(sorted.map { elements[$0]! }))
+
+			case let .insert(element, index):
+				let identifier = makeIdentifier()
+				elements[identifier] = element
+				let position = sortedIndex(of: identifier)
+				sorted.insert(identifier, at: position)
+				identifiers.insert(identifier, at: index)
+				output.append(.insert(element, at: position))
+
+			case let .remove(index):
+				let identifier = identifiers.remove(at: index)
+				let position = sortedIndex(of: identifier)
+				sorted.remove(at: position)
+				elements[identifier] = nil
+				output.append(.remove(at: position))
+
+			case let .update(element, index):
+				let identifier = identifiers[index]
+				let oldPosition = sortedIndex(of: identifier)
+				sorted.remove(at: oldPosition)
+				elements[identifier] = element
+				let newPosition = sortedIndex(of: identifier)
+				sorted.insert(identifier, at: newPosition)
+
+				if oldPosition != newPosition {
+					output.append(.move(from: oldPosition, to: newPosition))
+				}
+				output.append(.update(element, at: newPosition))
+
+			case let .move(source, destination):
+				// The sorted order does not depend on the source order.
+				identifiers.insert(identifiers.remove(at: source), at: destination)
+			}
+		}
+
+		return output
+	}
+}
@@ -160,6 +160,15 @@ public final class CompositeDisposable: Disposable {
 		self.init([Disposable]())
 	}
 
+	/// The estimated bytes held by `self`, excluding the disposables it contains.
+	internal var estimatedFootprint: Int {
+		let bag = disposables.withValue { $0?.estimatedFootprint ?? 0 }
+		return MemoryEstimate.object(storedBytes: MemoryLayout<(Atomic<Bag<Disposable>?>, UnsafeAtomicState<DisposableState>)>.size)
+			+ MemoryEstimate.object(storedBytes: MemoryLayout<DisposableState.RawValue>.size)
+			+ disposables.estimatedFootprint
+			+ bag
+	}
+
 	public func dispose() {
 		if state.tryDispose(), let disposables = disposables.swap(nil) {
 			for disposable in disposables {
@@ -225,6 +225,12 @@ extension Signal.Event {
 		}
 	}
 
+	internal static func fused<U>(_ makeStep: @escaping () -> (Value) -> U?) -> Transformation<U, Error> {
+		return { downstream, _ in
+			Operators.CompactMap(downstream: downstream, transform: makeStep())
+		}
+	}
+
 	internal static func mapError<E>(_ transform: @escaping (Error) -> E) -> Transformation<Value, E> {
 		return { downstream, _ in
 			Operators.MapError(downstream: downstream, transform: transform)
@@ -325,6 +331,14 @@ extension Signal.Event where Value: OptionalProtocol {
 	}
 }
 
+extension Signal.Event where Value == Data {
+	internal static func lines(separator: UInt8) -> Transformation<Data, Error> {
+		return { downstream, _ in
+			Operators.SplitLines(downstream: downstream, separator: separator)
+		}
+	}
+}
+
 extension Signal.Event {
 	internal static var collect: Transformation<[Value], Error> {
 		return collect { _, _ in false }
@@ -406,6 +420,8 @@ extension Signal.Event {
 
 	internal static func observe(on scheduler: Scheduler) -> Transformation<Value, Error> {
 		return { action, lifetime in
+			let inFlight = SignalMetrics.gauge(named: "observe(on:)")
+
 			lifetime.observeEnded {
 				scheduler.schedule {
 					action(.interrupted)
@@ -413,7 +429,11 @@ extension Signal.Event {
 			}
 
 			return Signal.Observer { event in
+				inFlight?.add(1)
+
 				scheduler.schedule {
+					inFlight?.add(-1)
+
 					if !lifetime.hasEnded {
 						action(event)
 					}
@@ -363,7 +363,7 @@ extension Signal where Value: SignalProducerConvertible, Error == Value.Error {
 		return observe { event in
 			switch event {
 			case let .value(value):
-				state.modify { $0.queue.append(value.producer) }
+				state.modify { $0.enqueue(value.producer) }
 				startNextIfNeeded()
 
 			case let .failed(error):
@@ -494,6 +494,10 @@ private final class ConcurrentFlattenState<Value, Error: Swift.Error> {
 	/// Whether the outer producer has completed.
 	var isOuterCompleted = false
 
+	/// The gauge of the waiting producers, if metrics were enabled when the state
+	/// was created.
+	private let queued = SignalMetrics.gauge(named: "flatten(.concurrent)")
+
 	/// Whether the flattened signal should complete.
 	var shouldComplete: Bool {
 		return isOuterCompleted && activeCount == 0 && queue.isEmpty
@@ -503,6 +507,19 @@ private final class ConcurrentFlattenState<Value, Error: Swift.Error> {
 		self.limit = limit
 	}
 
+	deinit {
+		queued?.add(-queue.count)
+	}
+
+	/// Enqueue a producer to be started.
+	///
+	/// - parameters:
+	///   - producer: The producer to start.
+	func enqueue(_ producer: Producer) {
+		queue.append(producer)
+		queued?.add(1)
+	}
+
 	/// Dequeue the next producer if one should be started.
 	///
 	/// - returns: The `Producer` to start or `nil` if no producer should be
@@ -510,6 +527,7 @@ private final class ConcurrentFlattenState<Value, Error: Swift.Error> {
 	func dequeue() -> Producer? {
 		if activeCount < limit, !queue.isEmpty {
 			activeCount += 1
+			queued?.add(-1)
 			return queue.removeFirst()
 		} else {
 			return nil
@@ -80,6 +80,145 @@ extension Reactive where Base: URLSession {
 	}
 }
 
+extension FileHandle: ReactiveExtensionsProvider {}
+
+extension Reactive where Base: FileHandle {
+	/// Returns a SignalProducer which reads the file handle in chunks, until the end
+	/// of the file is reached.
+	///
+	/// Every chunk is read in a separate action on `scheduler`, so that an
+	/// interruption takes effect between chunks.
+	///
+	/// - note: A chunk of `size` bytes owns the buffer it has been read into. A
+	///         shorter chunk, e.g. read from a pipe, is copied into a buffer of its
+	///         size, so that it does not hold `size` bytes.
+	///
+	/// - precondition: `size` must be positive.
+	///
+	/// - parameters:
+	///   - size: The maximum number of bytes in a chunk.
+	///   - scheduler: A scheduler to read the chunks on.
+	///
+	/// - returns: A producer that reads the chunks from the current offset of the file
+	///            handle once for each invocation of `start()`.
+	public func chunks(ofSize size: Int = 1 << 16, on scheduler: Scheduler) -> SignalProducer<Data, Error> {
+		precondition(size > 0)
+
+		return SignalProducer { [base = self.base] observer, lifetime in
+			let scheduledDisposable = SerialDisposable()
+			lifetime += scheduledDisposable
+
+			func readNextChunk() {
+				guard !lifetime.hasEnded else { return }
+
+				let buffer = UnsafeMutableRawPointer.allocate(byteCount: size, alignment: 1)
+				var count: Int
+
+				repeat {
+					count = read(base.fileDescriptor, buffer, size)
+				} while count < 0 && errno == EINTR
+
+				let code = count < 0 ? errno : 0
+
+				if count == size {
+					observer.send(value: Data(bytesNoCopy: buffer, count: count, deallocator: .custom { pointer, _ in pointer.deallocate() }))
+					scheduledDisposable.inner = scheduler.schedule(readNextChunk)
+					return
+				}
+
+				let chunk = count > 0 ? Data(bytes: buffer, count: count) : nil
+				buffer.deallocate()
+
+				if let chunk = chunk {
+					observer.send(value: chunk)
+					scheduledDisposable.inner = scheduler.schedule(readNextChunk)
+				} else if count == 0 {
+					observer.sendCompleted()
+				} else {
+					observer.send(error: NSError(domain: NSPOSIXErrorDomain, code: Int(code), userInfo: nil))
+				}
+			}
+
+			scheduledDisposable.inner = scheduler.schedule(readNextChunk)
+		}
+	}
+}
+
+extension FileManager: ReactiveExtensionsProvider {}
+
+extension Reactive where Base: FileManager {
+	/// Returns a SignalProducer which maps the file at the given URL into memory, and
+	/// sends its contents in chunks.
+	///
+	/// The chunks are slices of the mapped contents, so that no bytes are copied. The
+	/// pages of the file are read only once the bytes of a chunk are accessed.
+	///
+	/// - note: The contents remain mapped as long as any chunk is retained.
+	///
+	/// - precondition: `size` must be positive.
+	///
+	/// - parameters:
+	///   - url: The URL of the file.
+	///   - size: The number of bytes in every chunk except the last.
+	///   - scheduler: A scheduler to map the file and send every chunk on.
+	///
+	/// - returns: A producer that maps the file once for each invocation of
+	///            `start()`.
+	public func chunks(ofFileAt url: URL, size: Int = 1 << 20, on scheduler: Scheduler) -> SignalProducer<Data, Error> {
+		precondition(size > 0)
+
+		return SignalProducer<Data, Error> { try Data(contentsOf: url, options: .alwaysMapped) }
+			.start(on: scheduler)
+			.flatMap(.concat) { contents -> SignalProducer<Data, Error> in
+				let chunks = stride(from: contents.startIndex, to: contents.endIndex, by: size).lazy.map { start in
+					contents[start ..< min(start + size, contents.endIndex)]
+				}
+
+				return SignalProducer(chunks, batchSize: 1, on: scheduler)
+			}
+	}
+}
+
+extension Signal where Value == Data {
+	/// Split the received chunks of bytes into lines, which are separated by
+	/// `separator`. The separators are not included in the lines.
+	///
+	/// A line received within a chunk is a slice of the chunk, which shares its
+	/// storage, so that only the lines spanning chunks are copied. The bytes after the
+	/// last separator are sent as the last line when `self` completes.
+	///
+	/// - note: Like every slice of `Data`, a line keeps the indices of the chunk. Use
+	///         `startIndex` rather than `0` to access its bytes.
+	///
+	/// - parameters:
+	///   - separator: The byte separating the lines.
+	///
+	/// - returns: A signal that sends the lines.
+	public func lines(separator: UInt8 = UInt8(ascii: "\n")) -> Signal<Data, Error> {
+		return flatMapEvent(Signal.Event.lines(separator: separator))
+	}
+}
+
+extension SignalProducer where Value == Data {
+	/// Split the chunks of bytes sent by the produced `Signal` into lines, which are
+	/// separated by `separator`. The separators are not included in the lines.
+	///
+	/// A line received within a chunk is a slice of the chunk, which shares its
+	/// storage, so that only the lines spanning chunks are copied. The bytes after the
+	/// last separator are sent as the last line when `self` completes.
+	///
+	/// - note: Like every slice of `Data`, a line keeps the indices of the chunk. Use
+	///         `startIndex` rather than `0` to access its bytes.
+	///
+	/// - parameters:
+	///   - separator: The byte separating the lines.
+	///
+	/// - returns: A producer that sends the lines.
+	public func lines(separator: UInt8 = UInt8(ascii: "\n")) -> SignalProducer<Data, Error> {
+		return flatMapEvent(Signal.Event.lines(separator: separator))
+	}
+}
+
 extension Date {
 	internal func addingTimeInterval(_ interval: DispatchTimeInterval) -> Date {
 		return addingTimeInterval(interval.timeInterval)
@@ -0,0 +1,208 @@
+import Foundation
+#if os(iOS) || os(macOS) || os(tvOS) || os(watchOS)
+import Darwin.POSIX.pthread
+#else
+import Glibc
+#endif
+
+/// `LockChecking` is an opt-in checked mode of the locks used by `Signal`,
+/// `Property` and `Atomic`, which reports misuses that would otherwise hang.
+///
+/// A checked lock records the locks held by every thread, and the order in which
+/// pairs of locks have been acquired. It reports:
+///
+/// 1. The recursive acquisition of a non-recursive lock, e.g. a value sent to a
+///    `Signal` while it is delivering a value on the same thread, which would
+///    deadlock on its send lock.
+///
+/// 2. The acquisition of two locks in the reverse order of a previous acquisition,
+///    e.g. a `Signal` and a `Property` observing each other from two threads, which
+///    might deadlock.
+///
+/// Only the locks created while checking is enabled are checked, so it should be
+/// enabled early, e.g. at the start of a test suite or a debug build.
+///
+/// - note: The order is checked between the pairs of locks held at the same time.
+///         A cycle spanning three or more locks is not detected.
+public enum LockChecking {
+	private static let graphLock = Lock.PthreadLock()
+
+	/// The locks which have been acquired while holding a given lock.
+	private static var successors: [ObjectIdentifier: Set<ObjectIdentifier>] = [:]
+
+	/// The locks which have been held while acquiring a given lock.
+	private static var predecessors: [ObjectIdentifier: Set<ObjectIdentifier>] = [:]
+
+	/// The switch read by every lock creation, which is nonzero while checking is
+	/// enabled.
+	private static let isEnabledSwitch = AtomicInt32(0)
+
+	/// Guards `_violationHandler`. It is created directly, so that it is never checked.
+	private static let handlerLock = Lock.PthreadLock()
+	private static var _violationHandler: (LockViolation) -> Void = { violation in
+		fatalError(violation.description)
+	}
+
+	/// Whether locks created from now on are checked.
+	public static var isEnabled: Bool {
+		get { return isEnabledSwitch.load() != 0 }
+		set { isEnabledSwitch.store(newValue ? 1 : 0) }
+	}
+
+	/// The action invoked with every violation. It stops the process by default.
+	///
+	/// - note: The recursive acquisition of a non-recursive lock stops the process
+	///         even if the handler returns, since it would deadlock otherwise.
+	public static var violationHandler: (LockViolation) -> Void {
+		get {
+			handlerLock.lock()
+			defer { handlerLock.unlock() }
+			return _violationHandler
+		}
+
+		set {
+			handlerLock.lock()
+			_violationHandler = newValue
+			handlerLock.unlock()
+		}
+	}
+
+	internal static func willAcquire(_ lock: Lock.CheckedLock) {
+		let held = LockCheckingThreadState.current.heldLocks
+
+		if held.contains(where: { $0 === lock }) {
+			// Reentering a recursive lock neither blocks nor changes the order.
+			guard !lock.isRecursive else { return }
+
+			report(.recursiveAcquisition, of: lock, held: held)
+			fatalError("Recursive acquisition of \(lock.name) would deadlock.")
+		}
+
+		let identifier = ObjectIdentifier(lock)
+		var inverted: Lock.CheckedLock?
+
+		graphLock.lock()
+		for other in held where other !== lock {
+			let otherIdentifier = ObjectIdentifier(other)
+
+			if successors[identifier]?.contains(otherIdentifier) == true {
+				inverted = other
+				break
+			}
+
+			successors[otherIdentifier, default: []].insert(identifier)
+			predecessors[identifier, default: []].insert(otherIdentifier)
+		}
+		graphLock.unlock()
+
+		if let inverted = inverted {
+			report(.orderInversion(heldLock: "\(inverted.name)"), of: lock, held: held)
+		}
+	}
+
+	internal static func didAcquire(_ lock: Lock.CheckedLock) {
+		LockCheckingThreadState.current.heldLocks.append(lock)
+	}
+
+	internal static func willRelease(_ lock: Lock.CheckedLock) {
+		let state = LockCheckingThreadState.current
+		if let index = state.heldLocks.lastIndex(where: { $0 === lock }) {
+			state.heldLocks.remove(at: index)
+		}
+	}
+
+	internal static func lockDidDeinitialize(_ lock: Lock.CheckedLock) {
+		let identifier = ObjectIdentifier(lock)
+
+		graphLock.lock()
+		defer { graphLock.unlock() }
+
+		// The identifier may be reused by a new lock.
+		for successor in successors.removeValue(forKey: identifier) ?? [] {
+			predecessors[successor]?.remove(identifier)
+		}
+
+		for predecessor in predecessors.removeValue(forKey: identifier) ?? [] {
+			successors[predecessor]?.remove(identifier)
+		}
+	}
+
+	private static func report(_ kind: LockViolation.Kind, of lock: Lock.CheckedLock, held: [Lock.CheckedLock]) {
+		violationHandler(LockViolation(
+			kind: kind,
+			lock: "\(lock.name)",
+			heldLocks: held.map { "\($0.name)" },
+			callStack: Thread.callStackSymbols
+		))
+	}
+}
+
+/// A misuse of locks reported by `LockChecking`.
+public struct LockViolation: CustomStringConvertible {
+	/// The kind of a violation.
+	public enum Kind: Equatable {
+		/// A non-recursive lock is being acquired by the thread holding it.
+		case recursiveAcquisition
+
+		/// A lock is being acquired while holding a lock, which has previously been
+		/// acquired while holding the former.
+		case orderInversion(heldLock: String)
+	}
+
+	/// The kind of the violation.
+	public let kind: Kind
+
+	/// The name of the lock being acquired.
+	public let lock: String
+
+	/// The names of the locks held by the thread, in the order of acquisition.
+	public let heldLocks: [String]
+
+	/// The call stack of the acquisition.
+	public let callStack: [String]
+
+	public var description: String {
+		var lines: [String]
+
+		switch kind {
+		case .recursiveAcquisition where lock == "Signal.Core.sendLock":
+			lines = ["A value event has been sent to a Signal recursively, while it is delivering a value on the same thread. It would deadlock on \(lock)."]
+		case .recursiveAcquisition:
+			lines = ["\(lock) is being acquired recursively. It would deadlock."]
+		case let .orderInversion(heldLock):
+			lines = ["\(lock) is being acquired while holding \(heldLock), but \(heldLock) has previously been acquired while holding the same \(lock). It might deadlock."]
+		}
+
+		lines.append("Held locks: \(heldLocks.joined(separator: ", "))")
+		lines.append("Call stack:")
+		lines.append(contentsOf: callStack)
+		return lines.joined(separator: "\n")
+	}
+}
+
+/// The locks held by a thread.
+private final class LockCheckingThreadState {
+	var heldLocks: [Lock.CheckedLock] = []
+
+	private static let key: pthread_key_t = {
+		var key = pthread_key_t()
+		let status = pthread_key_create(&key) { pointer in
+			#if os(Linux)
+			guard let pointer = pointer else { return }
+			#endif
+			Unmanaged<LockCheckingThreadState>.fromOpaque(pointer).release()
+		}
+		precondition(status == 0, "Unexpected pthread key error code: \(status)")
+		return key
+	}()
+
+	static var current: LockCheckingThreadState {
+		if let pointer = pthread_getspecific(key) {
+			return Unmanaged<LockCheckingThreadState>.fromOpaque(pointer).takeUnretainedValue()
+		}
+
+		let state = LockCheckingThreadState()
+		pthread_setspecific(key, Unmanaged.passRetained(state).toOpaque())
+		return state
+	}
+}
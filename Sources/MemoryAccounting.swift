@@ -0,0 +1,311 @@
+import Foundation
+#if os(iOS) || os(macOS) || os(tvOS) || os(watchOS)
+import Darwin.POSIX.pthread
+#else
+import Glibc
+#endif
+
+/// The switch of `MemoryAccounting`, which is nonzero while objects register
+/// themselves. It is written only with the registry lock acquired.
+private let memoryAccountingSwitch = AtomicInt32(0)
+
+/// Whether signals, buffering operators and schedulers register themselves for
+/// memory accounting. It is read as they are created, so that accounting costs a
+/// single atomic load and branch when it is disabled.
+internal var isMemoryAccountingEnabled: Bool {
+	return memoryAccountingSwitch.load() != 0
+}
+
+/// `MemoryAccounting` estimates the memory held by signals, buffering operators and
+/// scheduler queues, and aggregates it by pipeline.
+///
+/// Objects created within `withLabel(_:_:)` are accounted to the given pipeline
+/// label. The registry holds the objects weakly, and the estimates are taken when a
+/// report is made.
+///
+/// ```
+/// MemoryAccounting.start()
+///
+/// let disposable = MemoryAccounting.withLabel("feed") {
+///     feed.producer.map(render).start(observer)
+/// }
+///
+/// let report = MemoryAccounting.report()
+/// assert(report.overBudget(["feed": 4096]).isEmpty)
+/// ```
+///
+/// The estimates account for the object headers, the stored properties and the
+/// capacity of the buffers held, with the allocations rounded up to 16 bytes. They
+/// exclude the contexts of the closures supplied by the user, and the values
+/// referenced by the buffered values.
+///
+/// - note: Some buffers, e.g. of `collect`, are mutated only by their upstream and
+///         are estimated without synchronization. Take reports while the pipelines
+///         are idle.
+public enum MemoryAccounting {
+	/// The label of the objects created outside of any `withLabel(_:_:)` scope.
+	public static let unlabeled = "(unlabeled)"
+
+	private static let lock = Lock.make()
+	private static var entries: [MemoryAccountingEntry] = []
+	private static var pruneThreshold = 1024
+
+	/// Whether objects are being registered.
+	public static var isEnabled: Bool {
+		return isMemoryAccountingEnabled
+	}
+
+	/// Start registering objects created from now on.
+	public static func start() {
+		lock.lock()
+		memoryAccountingSwitch.store(1)
+		lock.unlock()
+	}
+
+	/// Stop registering objects, and clear the registry.
+	public static func stop() {
+		lock.lock()
+		memoryAccountingSwitch.store(0)
+		entries.removeAll()
+		pruneThreshold = 1024
+		lock.unlock()
+	}
+
+	/// Account the objects created by `action` on the current thread to the given
+	/// pipeline label. Scopes can be nested, in which case the innermost label is used.
+	///
+	/// - parameters:
+	///   - label: The label of the pipeline.
+	///   - action: The action creating the pipeline.
+	///
+	/// - returns: The result of `action`.
+	public static func withLabel<Result>(_ label: String, _ action: () throws -> Result) rethrows -> Result {
+		let state = MemoryAccountingThreadState.current
+		state.labels.append(label)
+		defer { state.labels.removeLast() }
+
+		return try action()
+	}
+
+	/// Estimate the memory held by the live objects registered.
+	///
+	/// - returns: The report aggregated by pipeline label.
+	public static func report() -> MemoryFootprintReport {
+		lock.lock()
+		entries.removeAll { $0.owner == nil }
+		let live = entries.compactMap { entry in entry.owner.map { (entry, $0) } }
+		lock.unlock()
+
+		// Estimate without the registry lock acquired, since the estimates acquire
+		// the locks of the objects.
+		var pipelines: [String: [String: ComponentFootprint]] = [:]
+
+		for (entry, owner) in live {
+			let bytes = entry.estimate(owner)
+			let component = pipelines[entry.label, default: [:]][entry.kind] ?? ComponentFootprint(count: 0, bytes: 0)
+			pipelines[entry.label, default: [:]][entry.kind] = ComponentFootprint(count: component.count + 1, bytes: component.bytes + bytes)
+		}
+
+		return MemoryFootprintReport(pipelines: pipelines.mapValues(PipelineFootprint.init))
+	}
+
+	/// Register an object for accounting, with the label of the current scope.
+	///
+	/// - parameters:
+	///   - owner: The object, which is held weakly.
+	///   - kind: The kind of the object in the report.
+	///   - estimate: A closure estimating the memory held by the object in bytes.
+	internal static func track<Owner: AnyObject>(_ owner: Owner, kind: String, estimate: @escaping (Owner) -> Int) {
+		let label = MemoryAccountingThreadState.current.labels.last ?? unlabeled
+		let entry = MemoryAccountingEntry(owner: owner, kind: kind, label: label) { estimate($0 as! Owner) }
+
+		lock.lock()
+		defer { lock.unlock() }
+
+		// Accounting may have been stopped since the caller checked the switch.
+		guard isMemoryAccountingEnabled else { return }
+
+		entries.append(entry)
+
+		if entries.count > pruneThreshold {
+			entries.removeAll { $0.owner == nil }
+			pruneThreshold = max(1024, entries.count * 2)
+		}
+	}
+}
+
+private final class MemoryAccountingEntry {
+	weak var owner: AnyObject?
+	let kind: String
+	let label: String
+	let estimate: (AnyObject) -> Int
+
+	init(owner: AnyObject, kind: String, label: String, estimate: @escaping (AnyObject) -> Int) {
+		self.owner = owner
+		self.kind = kind
+		self.label = label
+		self.estimate = estimate
+	}
+}
+
+/// The labels of the `withLabel(_:_:)` scopes entered by a thread.
+private final class MemoryAccountingThreadState {
+	var labels: [String] = []
+
+	private static let key: pthread_key_t = {
+		var key = pthread_key_t()
+		let status = pthread_key_create(&key) { pointer in
+			#if os(Linux)
+			guard let pointer = pointer else { return }
+			#endif
+			Unmanaged<MemoryAccountingThreadState>.fromOpaque(pointer).release()
+		}
+		precondition(status == 0, "Unexpected pthread key error code: \(status)")
+		return key
+	}()
+
+	static var current: MemoryAccountingThreadState {
+		if let pointer = pthread_getspecific(key) {
+			return Unmanaged<MemoryAccountingThreadState>.fromOpaque(pointer).takeUnretainedValue()
+		}
+
+		let state = MemoryAccountingThreadState()
+		pthread_setspecific(key, Unmanaged.passRetained(state).toOpaque())
+		return state
+	}
+}
+
+/// A report of the memory held by the live objects registered by
+/// `MemoryAccounting`.
+public struct MemoryFootprintReport {
+	/// The footprint of every pipeline, keyed by its label.
+	public let pipelines: [String: PipelineFootprint]
+
+	/// The estimated bytes held by all pipelines.
+	public var bytes: Int {
+		return pipelines.values.reduce(0) { $0 + $1.bytes }
+	}
+
+	/// Check the pipelines against their expected footprint.
+	///
+	/// - parameters:
+	///   - budgets: The expected footprint in bytes of pipelines, keyed by label.
+	///
+	/// - returns: The bytes in excess of the expected footprint, keyed by the label
+	///            of the pipelines exceeding it.
+	public func overBudget(_ budgets: [String: Int]) -> [String: Int] {
+		var excess: [String: Int] = [:]
+
+		for (label, budget) in budgets {
+			let bytes = pipelines[label]?.bytes ?? 0
+			if bytes > budget {
+				excess[label] = bytes - budget
+			}
+		}
+
+		return excess
+	}
+}
+
+/// The memory held by a pipeline.
+public struct PipelineFootprint {
+	/// The footprint of every kind of component, e.g. `Signal` or `zip`.
+	public let components: [String: ComponentFootprint]
+
+	/// The estimated bytes held by the pipeline.
+	public var bytes: Int {
+		return components.values.reduce(0) { $0 + $1.bytes }
+	}
+}
+
+/// The memory held by a kind of component of a pipeline.
+public struct ComponentFootprint: Equatable {
+	/// The number of live components.
+	public let count: Int
+
+	/// The estimated bytes held by the components.
+	public let bytes: Int
+}
+
+/// Estimates of the heap allocations of common storage.
+///
+/// The layouts assumed are those of the Swift 5 runtime and standard library.
+internal enum MemoryEstimate {
+	/// The header of a native Swift object: its metadata pointer and its inline
+	/// reference counts.
+	private static let objectHeader = MemoryLayout<(metadata: UnsafeRawPointer, referenceCounts: UInt)>.size
+
+	/// The granularity of heap allocations, which is 16 bytes for the default
+	/// allocators of Darwin and of 64-bit glibc.
+	private static let allocationGranularity = 16
+
+	/// The header of the buffer of an array, which follows the object header.
+	private static let arrayHeader = MemoryLayout<(count: Int, capacityAndFlags: UInt)>.size
+
+	/// The header of the storage of a set, which follows the object header. The
+	/// bitmap of the occupied buckets, and then the elements, are allocated after it.
+	/// The storage of a dictionary has a second elements pointer, for the values.
+	private static let setHeader = MemoryLayout<(
+		count: Int,
+		capacity: Int,
+		scale: Int8,
+		reservedScale: Int8,
+		extra: Int16,
+		age: Int32,
+		seed: Int,
+		rawElements: UnsafeMutableRawPointer
+	)>.size
+
+	/// The maximum load factor of a set or a dictionary, which determines the number
+	/// of its buckets.
+	private static let setMaximumLoadFactor = 3.0 / 4.0
+
+	/// The size of a heap object with the given stored properties, including the
+	/// object header and the rounding of the allocator.
+	static func object(storedBytes: Int) -> Int {
+		let size = objectHeader + storedBytes
+		return (size + allocationGranularity - 1) / allocationGranularity * allocationGranularity
+	}
+
+	/// The size of the heap buffer of an array, or zero if it has none.
+	static func buffer<Element>(capacity: Int, of type: Element.Type) -> Int {
+		return capacity > 0 ? object(storedBytes: arrayHeader + capacity * MemoryLayout<Element>.stride) : 0
+	}
+
+	static func array<Element>(_ array: [Element]) -> Int {
+		return buffer(capacity: array.capacity, of: Element.self)
+	}
+
+	static func array<Element>(_ array: ContiguousArray<Element>) -> Int {
+		return buffer(capacity: array.capacity, of: Element.self)
+	}
+
+	/// The size of the heap storage of a set, or zero if it has none.
+	static func set<Element>(_ set: Set<Element>) -> Int {
+		return hashedStorage(capacity: set.capacity, entryStride: MemoryLayout<Element>.stride)
+	}
+
+	/// The size of the heap storage of a dictionary, or zero if it has none. The keys
+	/// and the values are held in separate arrays of buckets.
+	static func dictionary<Key, Value>(_ dictionary: [Key: Value]) -> Int {
+		return hashedStorage(
+			capacity: dictionary.capacity,
+			entryStride: MemoryLayout<Key>.stride + MemoryLayout<Value>.stride,
+			extraHeader: MemoryLayout<UnsafeMutableRawPointer>.size
+		)
+	}
+
+	/// The size of the storage of a set or a dictionary. The storage has a power of
+	/// two number of buckets, and a bitmap of the occupied ones.
+	private static func hashedStorage(capacity: Int, entryStride: Int, extraHeader: Int = 0) -> Int {
+		guard capacity > 0 else { return 0 }
+
+		var buckets = 1
+		while Double(buckets) * setMaximumLoadFactor < Double(capacity) {
+			buckets *= 2
+		}
+
+		let bitmapWords = (buckets + UInt.bitWidth - 1) / UInt.bitWidth
+		return object(storedBytes: setHeader + extraHeader + bitmapWords * MemoryLayout<UInt>.size + buckets * entryStride)
+	}
+}
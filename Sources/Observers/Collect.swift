@@ -34,6 +34,14 @@ extension Operators {
 		private init(downstream: Observer<[Value], Error>, modify: @escaping (_ collected: inout [Value], _ latest: Value) -> [Value]?) {
 			self.downstream = downstream
 			self.modify = modify
+			super.init()
+
+			if isMemoryAccountingEnabled {
+				MemoryAccounting.track(self, kind: "collect") { collect in
+					MemoryEstimate.object(storedBytes: MemoryLayout<(Observer<[Value], Error>, (inout [Value], Value) -> [Value]?, [Value], Bool)>.size)
+						+ MemoryEstimate.array(collect.values)
+				}
+			}
 		}
 
 		override func receive(_ value: Value) {
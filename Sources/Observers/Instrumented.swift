@@ -0,0 +1,23 @@
+extension Operators {
+	internal final class Instrumented<Value, Error: Swift.Error>: Observer<Value, Error> {
+		let downstream: Observer<Value, Error>
+		let stage: SignalMetricsStage
+
+		init(downstream: Observer<Value, Error>, stage: SignalMetricsStage) {
+			self.downstream = downstream
+			self.stage = stage
+		}
+
+		override func receive(_ value: Value) {
+			let start = SignalMetrics.now()
+			downstream.receive(value)
+			stage.record(.value, since: start)
+		}
+
+		override func terminate(_ termination: Termination<Error>) {
+			let start = SignalMetrics.now()
+			downstream.terminate(termination)
+			stage.record(SignalMetricsEvent(termination), since: start)
+		}
+	}
+}
@@ -0,0 +1,64 @@
+import Foundation
+
+extension Operators {
+	internal final class SplitLines<Error: Swift.Error>: Observer<Data, Error> {
+		let downstream: Observer<Data, Error>
+		let separator: UInt8
+
+		/// The bytes of the line which has not been terminated by a separator yet.
+		private var remainder = Data()
+
+		init(downstream: Observer<Data, Error>, separator: UInt8) {
+			self.downstream = downstream
+			self.separator = separator
+		}
+
+		override func receive(_ chunk: Data) {
+			let separatorOffsets = chunk.withUnsafeBytes { bytes -> [Int] in
+				guard let base = bytes.baseAddress else { return [] }
+
+				var offsets: [Int] = []
+				var offset = 0
+
+				while offset < bytes.count, let found = memchr(base + offset, Int32(separator), bytes.count - offset) {
+					offset = base.distance(to: UnsafeRawPointer(found))
+					offsets.append(offset)
+					offset += 1
+				}
+
+				return offsets
+			}
+
+			var lineStart = chunk.startIndex
+
+			for separatorOffset in separatorOffsets {
+				let separatorIndex = chunk.startIndex + separatorOffset
+
+				// A line within a chunk is a slice of it, which shares its storage. Only a
+				// line spanning chunks is copied.
+				if remainder.isEmpty {
+					downstream.receive(chunk[lineStart ..< separatorIndex])
+				} else {
+					remainder.append(chunk[lineStart ..< separatorIndex])
+					downstream.receive(remainder)
+					remainder = Data()
+				}
+
+				lineStart = separatorIndex + 1
+			}
+
+			if lineStart < chunk.endIndex {
+				remainder.append(chunk[lineStart...])
+			}
+		}
+
+		override func terminate(_ termination: Termination<Error>) {
+			if case .completed = termination, !remainder.isEmpty {
+				downstream.receive(remainder)
+				remainder = Data()
+			}
+
+			downstream.terminate(termination)
+		}
+	}
+}
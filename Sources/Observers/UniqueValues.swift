@@ -8,6 +8,14 @@ extension Operators {
 		init(downstream: Observer<Value, Error>, extract: @escaping (Value) -> Identity) {
 			self.downstream = downstream
 			self.extract = extract
+			super.init()
+
+			if isMemoryAccountingEnabled {
+				MemoryAccounting.track(self, kind: "uniqueValues") { uniqueValues in
+					MemoryEstimate.object(storedBytes: MemoryLayout<(Observer<Value, Error>, (Value) -> Identity, Set<Identity>)>.size)
+						+ MemoryEstimate.set(uniqueValues.seenIdentities)
+				}
+			}
 		}
 
 		override func receive(_ value: Value) {
@@ -0,0 +1,284 @@
+/// A stage of a fused pipeline, which transforms every value it receives into at
+/// most one value.
+///
+/// Stages are value types, which `PipelineBuilder` composes into a single value of a
+/// concrete type. See `Signal.pipeline(_:)` and `SignalProducer.pipeline(_:)`.
+public protocol PipelineStage {
+	/// The type of values received by the stage.
+	associatedtype Input
+
+	/// The type of values forwarded by the stage.
+	associatedtype Output
+
+	/// Process a value received by the stage.
+	///
+	/// - parameters:
+	///   - input: The value.
+	///
+	/// - returns: The value to be forwarded, or `nil` if `input` is dropped.
+	mutating func receive(_ input: Input) -> Output?
+}
+
+/// The stages which can be composed into a fused pipeline.
+public enum Pipeline {
+	/// Map every value to a new value.
+	public struct Map<Input, Output>: PipelineStage {
+		@usableFromInline
+		internal let transform: (Input) -> Output
+
+		/// - parameters:
+		///   - transform: A closure that accepts a value and returns a new value.
+		@inlinable
+		public init(_ transform: @escaping (Input) -> Output) {
+			self.transform = transform
+		}
+
+		@inlinable
+		public mutating func receive(_ input: Input) -> Output? {
+			return transform(input)
+		}
+	}
+
+	/// Forward only the values which pass the given predicate.
+	public struct Filter<Value>: PipelineStage {
+		@usableFromInline
+		internal let isIncluded: (Value) -> Bool
+
+		/// - parameters:
+		///   - isIncluded: A closure to determine whether a value should be forwarded.
+		@inlinable
+		public init(_ isIncluded: @escaping (Value) -> Bool) {
+			self.isIncluded = isIncluded
+		}
+
+		@inlinable
+		public mutating func receive(_ input: Value) -> Value? {
+			return isIncluded(input) ? input : nil
+		}
+	}
+
+	/// Map every value to an optional value, and forward the non-`nil` results.
+	public struct CompactMap<Input, Output>: PipelineStage {
+		@usableFromInline
+		internal let transform: (Input) -> Output?
+
+		/// - parameters:
+		///   - transform: A closure that accepts a value and returns a new optional
+		///                value.
+		@inlinable
+		public init(_ transform: @escaping (Input) -> Output?) {
+			self.transform = transform
+		}
+
+		@inlinable
+		public mutating func receive(_ input: Input) -> Output? {
+			return transform(input)
+		}
+	}
+
+	/// Combine every value with the accumulated result, and forward every
+	/// intermediate result.
+	///
+	/// The result is accumulated separately by every started `SignalProducer`.
+	public struct Scan<Input, Result>: PipelineStage {
+		@usableFromInline
+		internal var result: Result
+
+		@usableFromInline
+		internal let nextPartialResult: (inout Result, Input) -> Void
+
+		/// - parameters:
+		///   - initialResult: The value to use as the initial accumulating value.
+		///   - nextPartialResult: A closure that accepts the accumulating value and a
+		///                        value, and returns a new accumulating value.
+		@inlinable
+		public init(_ initialResult: Result, _ nextPartialResult: @escaping (Result, Input) -> Result) {
+			self.init(into: initialResult) { $0 = nextPartialResult($0, $1) }
+		}
+
+		/// - parameters:
+		///   - initialResult: The value to use as the initial accumulating value.
+		///   - nextPartialResult: A closure that accepts the accumulating value as
+		///                        `inout` and a value, and updates the former.
+		@inlinable
+		public init(into initialResult: Result, _ nextPartialResult: @escaping (inout Result, Input) -> Void) {
+			self.result = initialResult
+			self.nextPartialResult = nextPartialResult
+		}
+
+		@inlinable
+		public mutating func receive(_ input: Input) -> Result? {
+			nextPartialResult(&result, input)
+			return result
+		}
+	}
+
+	/// Forward only the values which are not equivalent to the previous value.
+	///
+	/// The previous value is held separately by every started `SignalProducer`.
+	public struct SkipRepeats<Value>: PipelineStage {
+		@usableFromInline
+		internal var previous: Value?
+
+		@usableFromInline
+		internal let isEquivalent: (Value, Value) -> Bool
+
+		/// - parameters:
+		///   - isEquivalent: A closure to determine whether two values are equivalent.
+		@inlinable
+		public init(_ isEquivalent: @escaping (Value, Value) -> Bool) {
+			self.previous = nil
+			self.isEquivalent = isEquivalent
+		}
+
+		@inlinable
+		public mutating func receive(_ input: Value) -> Value? {
+			defer { previous = input }
+
+			if let previous = previous, isEquivalent(previous, input) {
+				return nil
+			}
+			return input
+		}
+	}
+
+	/// Two stages of which the first forwards its values to the second.
+	public struct Composed<First: PipelineStage, Second: PipelineStage>: PipelineStage where First.Output == Second.Input {
+		@usableFromInline
+		internal var first: First
+
+		@usableFromInline
+		internal var second: Second
+
+		/// - parameters:
+		///   - first: The stage receiving the values.
+		///   - second: The stage receiving the values forwarded by `first`.
+		@inlinable
+		public init(_ first: First, _ second: Second) {
+			self.first = first
+			self.second = second
+		}
+
+		@inlinable
+		public mutating func receive(_ input: First.Input) -> Second.Output? {
+			guard let intermediate = first.receive(input) else { return nil }
+			return second.receive(intermediate)
+		}
+	}
+}
+
+extension Pipeline.SkipRepeats where Value: Equatable {
+	/// Forward only the values which are not equal to the previous value.
+	@inlinable
+	public init() {
+		self.init(==)
+	}
+}
+
+/// Composes the stages listed in a closure, in order, into a `Pipeline.Composed`
+/// stage.
+@_functionBuilder
+public enum PipelineBuilder {
+	public static func buildBlock<S0: PipelineStage>(_ s0: S0) -> S0 {
+		return s0
+	}
+
+	public static func buildBlock<S0: PipelineStage, S1: PipelineStage>(_ s0: S0, _ s1: S1) -> Pipeline.Composed<S0, S1> where S0.Output == S1.Input {
+		return Pipeline.Composed(s0, s1)
+	}
+
+	public static func buildBlock<S0: PipelineStage, S1: PipelineStage, S2: PipelineStage>(_ s0: S0, _ s1: S1, _ s2: S2) -> Pipeline.Composed<Pipeline.Composed<S0, S1>, S2> where S0.Output == S1.Input, S1.Output == S2.Input {
+		return Pipeline.Composed(buildBlock(s0, s1), s2)
+	}
+
+	public static func buildBlock<S0: PipelineStage, S1: PipelineStage, S2: PipelineStage, S3: PipelineStage>(_ s0: S0, _ s1: S1, _ s2: S2, _ s3: S3) -> Pipeline.Composed<Pipeline.Composed<Pipeline.Composed<S0, S1>, S2>, S3> where S0.Output == S1.Input, S1.Output == S2.Input, S2.Output == S3.Input {
+		return Pipeline.Composed(buildBlock(s0, s1, s2), s3)
+	}
+
+	public static func buildBlock<S0: PipelineStage, S1: PipelineStage, S2: PipelineStage, S3: PipelineStage, S4: PipelineStage>(_ s0: S0, _ s1: S1, _ s2: S2, _ s3: S3, _ s4: S4) -> Pipeline.Composed<Pipeline.Composed<Pipeline.Composed<Pipeline.Composed<S0, S1>, S2>, S3>, S4> where S0.Output == S1.Input, S1.Output == S2.Input, S2.Output == S3.Input, S3.Output == S4.Input {
+		return Pipeline.Composed(buildBlock(s0, s1, s2, s3), s4)
+	}
+
+	public static func buildBlock<S0: PipelineStage, S1: PipelineStage, S2: PipelineStage, S3: PipelineStage, S4: PipelineStage, S5: PipelineStage>(_ s0: S0, _ s1: S1, _ s2: S2, _ s3: S3, _ s4: S4, _ s5: S5) -> Pipeline.Composed<Pipeline.Composed<Pipeline.Composed<Pipeline.Composed<Pipeline.Composed<S0, S1>, S2>, S3>, S4>, S5> where S0.Output == S1.Input, S1.Output == S2.Input, S2.Output == S3.Input, S3.Output == S4.Input, S4.Output == S5.Input {
+		return Pipeline.Composed(buildBlock(s0, s1, s2, s3, s4), s5)
+	}
+}
+
+extension Signal {
+	/// Apply a pipeline of stages to the values of `self`.
+	///
+	/// The stages are composed into a single stage of a concrete type, which is driven
+	/// by a single observer. Unlike the equivalent chain of operators, which creates
+	/// an observer per operator and dispatches dynamically between them, the stages
+	/// can be specialized and inlined into one another by the compiler.
+	///
+	/// ```
+	/// let totals = amounts.pipeline {
+	///     Pipeline.Filter { (amount: Int) in amount > 0 }
+	///     Pipeline.Map { (amount: Int) in amount * 100 }
+	///     Pipeline.Scan(0) { (total: Int, amount: Int) in total + amount }
+	/// }
+	/// ```
+	///
+	/// - note: Every statement of the closure is type checked on its own, so the
+	///         types of the closure parameters of a stage cannot be inferred from
+	///         the previous stage. Annotate them where they are ambiguous.
+	///
+	/// - parameters:
+	///   - build: A closure listing the stages, in the order in which the values are
+	///            forwarded.
+	///
+	/// - returns: A signal that forwards the values forwarded by the last stage.
+	@inlinable
+	public func pipeline<Stage: PipelineStage>(@PipelineBuilder _ build: () -> Stage) -> Signal<Stage.Output, Error> where Stage.Input == Value {
+		let stage = build()
+		return fused {
+			var stage = stage
+			return { stage.receive($0) }
+		}
+	}
+
+	/// Apply the steps created by the given closure to the values of `self`.
+	@usableFromInline
+	internal func fused<U>(_ makeStep: @escaping () -> (Value) -> U?) -> Signal<U, Error> {
+		return flatMapEvent(Signal.Event.fused(makeStep), name: "pipeline(_:)")
+	}
+}
+
+extension SignalProducer {
+	/// Apply a pipeline of stages to the values of the produced `Signal`.
+	///
+	/// The stages are composed into a single stage of a concrete type, which is driven
+	/// by a single observer. Unlike the equivalent chain of operators, which creates
+	/// an observer per operator and dispatches dynamically between them, the stages
+	/// can be specialized and inlined into one another by the compiler.
+	///
+	/// Every started producer receives its own copy of the stages, so the state of
+	/// stages like `Pipeline.Scan` is not shared.
+	///
+	/// - note: Every statement of the closure is type checked on its own, so the
+	///         types of the closure parameters of a stage cannot be inferred from
+	///         the previous stage. Annotate them where they are ambiguous.
+	///
+	/// - parameters:
+	///   - build: A closure listing the stages, in the order in which the values are
+	///            forwarded.
+	///
+	/// - returns: A producer that, when started, forwards the values forwarded by the
+	///            last stage.
+	@inlinable
+	public func pipeline<Stage: PipelineStage>(@PipelineBuilder _ build: () -> Stage) -> SignalProducer<Stage.Output, Error> where Stage.Input == Value {
+		let stage = build()
+		return fused {
+			var stage = stage
+			return { stage.receive($0) }
+		}
+	}
+
+	/// Apply the steps created by the given closure to the values of every produced
+	/// `Signal`.
+	@usableFromInline
+	internal func fused<U>(_ makeStep: @escaping () -> (Value) -> U?) -> SignalProducer<U, Error> {
+		return flatMapEvent(Signal.Event.fused(makeStep), name: "pipeline(_:)")
+	}
+}
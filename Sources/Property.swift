@@ -126,6 +126,24 @@ extension PropertyProtocol {
 		return lift { $0.map(keyPath) }
 	}
 
+	/// Maps the current value and all subsequent values to a new property, which
+	/// evaluates `transform` lazily.
+	///
+	/// Unlike `map`, the resulting property only marks itself as outdated when
+	/// `self` changes. `transform` is applied when `value` is read, or eagerly if
+	/// the property has any active observer of its `signal` or `producer`.
+	///
+	/// - note: `transform` is applied at most once for every value of `self`.
+	///
+	/// - parameters:
+	///   - transform: A closure that will map the current `value` of this
+	///                `Property` to a new value.
+	///
+	/// - returns: A property that holds a lazily mapped value from `self`.
+	public func lazyMap<U>(_ transform: @escaping (Value) -> U) -> Property<U> {
+		return Property(unsafeProducer: producer, lazilyTransformingBy: transform)
+	}
+
 	/// Passes only the values of the property that pass the given predicate
 	/// to a new property.
 	///
@@ -556,6 +574,18 @@ public final class Property<Value>: PropertyProtocol {
 		signal = Signal<Value, Never>.empty
 	}
 
+	/// Initializes a property with the given constituents.
+	///
+	/// - parameters:
+	///   - value: A closure returning the current value.
+	///   - producer: The producer of the property.
+	///   - signal: The signal of the property.
+	private init(value: @escaping () -> Value, producer: SignalProducer<Value, Never>, signal: Signal<Value, Never>) {
+		_value = value
+		self.producer = producer
+		self.signal = signal
+	}
+
 	/// Initializes an existential property which wraps the given property.
 	///
 	/// - note: The resulting property retains the given property.
@@ -636,6 +666,11 @@ public final class Property<Value>: PropertyProtocol {
 		let disposable = SerialDisposable()
 		let (relay, observer) = Signal<Value, Never>.pipe(disposable: disposable)
 
+		// The height of the property in the property graph is determined by the
+		// properties whose producers are started by `unsafeProducer`.
+		let context = PropertyThreadContext.current
+		context.beginCollectingHeight()
+
 		disposable.inner = unsafeProducer.start { [weak box] event in
 			// `observer` receives `interrupted` only as a result of the termination of
 			// `signal`, and would not be delivered anyway. So transforming
@@ -653,10 +688,26 @@ public final class Property<Value>: PropertyProtocol {
 						value = newValue
 					}
 				}
+
+				// A transaction being committed defers the delivery of a new value
+				// until all properties of lower heights have propagated their changes,
+				// so that the property emits only once with a consistent value.
+				if box.height > 0 {
+					if event.isTerminating {
+						PropertyTransaction.current?.flushIfPending(box)
+					} else if let transaction = PropertyTransaction.committing {
+						return transaction.enqueue(box, height: box.height) {
+							box.begin { storage in observer.send(value: storage.value!) }
+						}
+					}
+				}
+
 				observer.send(event)
 			}
 		}
 
+		box.setHeight(context.endCollectingHeight())
+
 		// Verify that an initial is sent. This is friendlier than deadlocking
 		// in the event that one isn't.
 		guard box.value != nil else {
@@ -666,12 +717,88 @@ public final class Property<Value>: PropertyProtocol {
 		_value = { box.value! }
 		signal = relay
 
-		producer = SignalProducer { [box, relay] observer, lifetime in
-			box.withValue { value in
-				observer.send(value: value!)
-				lifetime += relay.observe(Signal.Observer(mappingInterruptedToCompleted: observer))
+		producer = SignalProducer(PropertyProducerCore(box: box, relay: relay) { $0.value! })
+	}
+}
+
+extension Property {
+	/// Initialize a composed property which lazily applies `transform` to the values
+	/// of a producer that promises to send at least one value synchronously in its
+	/// start handler before sending any subsequent event.
+	///
+	/// - warning: If the producer fails its promise, a fatal error would be
+	///            raised.
+	///
+	/// - parameters:
+	///   - unsafeProducer: The composed producer for creating the property.
+	///   - transform: The transform to be applied lazily.
+	fileprivate convenience init<Source>(unsafeProducer: SignalProducer<Source, Never>, lazilyTransformingBy transform: @escaping (Source) -> Value) {
+		// The ownership graph is identical to the one of an eager composed property,
+		// except that the upstream observer does not hold the relay signal strongly,
+		// since it inspects the relay for active observers.
+		let box = PropertyBox<LazyPropertyValue<Source, Value>?>(nil)
+
+		let disposable = SerialDisposable()
+		let (relay, observer) = Signal<Value, Never>.pipe(disposable: disposable)
+
+		func evaluate(_ storage: PropertyStorage<LazyPropertyValue<Source, Value>?>) -> Value {
+			switch storage.value! {
+			case let .evaluated(value):
+				return value
+			case let .outdated(source):
+				let value = transform(source)
+				storage.modify { $0 = .evaluated(value) }
+				return value
 			}
 		}
+
+		let context = PropertyThreadContext.current
+		context.beginCollectingHeight()
+
+		disposable.inner = unsafeProducer.start { [weak box, weak relay] event in
+			guard let box = box else {
+				return observer.send(event.map(transform))
+			}
+
+			box.begin { storage in
+				guard case let .value(source) = event else {
+					PropertyTransaction.current?.flushIfPending(box)
+					return observer.send(event.map(transform))
+				}
+
+				storage.modify { $0 = .outdated(source) }
+
+				// Propagate eagerly only if there is demand for the new value.
+				guard relay?.hasObservers == true else { return }
+
+				if box.height > 0, let transaction = PropertyTransaction.committing {
+					transaction.enqueue(box, height: box.height) {
+						box.begin { storage in observer.send(value: evaluate(storage)) }
+					}
+				} else {
+					observer.send(value: evaluate(storage))
+				}
+			}
+		}
+
+		box.setHeight(context.endCollectingHeight())
+
+		// Verify that an initial is sent. This is friendlier than deadlocking
+		// in the event that one isn't.
+		guard box.value != nil else {
+			fatalError("The producer promised to send at least one value. Received none.")
+		}
+
+		self.init(
+			value: {
+				if case let .evaluated(value)? = box.value {
+					return value
+				}
+				return box.begin(evaluate)
+			},
+			producer: SignalProducer(PropertyProducerCore(box: box, relay: relay, currentValue: evaluate)),
+			signal: relay
+		)
 	}
 }
 
@@ -707,6 +834,11 @@ public final class MutableProperty<Value>: ComposableMutablePropertyProtocol {
 	private let token: Lifetime.Token
 	private let observer: Signal<Value, Never>.Observer
 	private let box: PropertyBox<Value>
+	private let isEquivalent: ((Value, Value) -> Bool)?
+
+	/// The core of `producer`, which is created on first use. It is guarded by the
+	/// read lock of `box`.
+	private var producerCore: PropertyProducerCore<Value, Value>?
 
 	/// The current value of the property.
 	///
@@ -739,26 +871,42 @@ public final class MutableProperty<Value>: ComposableMutablePropertyProtocol {
 	/// followed by all changes over time, then complete when the property has
 	/// deinitialized.
 	public var producer: SignalProducer<Value, Never> {
-		return SignalProducer { [box, signal] observer, lifetime in
-			box.withValue { value in
-				observer.send(value: value)
-				lifetime += signal.observe(Signal.Observer(mappingInterruptedToCompleted: observer))
+		let core: PropertyProducerCore<Value, Value> = box.withReadLock {
+			if let core = producerCore {
+				return core
 			}
+
+			let core = PropertyProducerCore(box: box, relay: signal) { $0.value }
+			producerCore = core
+			return core
 		}
+
+		return SignalProducer(core)
 	}
 
 	/// Initializes a mutable property that first takes on `initialValue`
 	///
 	/// - parameters:
 	///   - initialValue: Starting value for the mutable property.
-	public init(_ initialValue: Value) {
-		(signal, observer) = Signal.pipe()
-		(lifetime, token) = Lifetime.make()
+	public convenience init(_ initialValue: Value) {
+		self.init(initialValue, isEquivalent: nil)
+	}
 
-		/// Need a recursive lock around `value` to allow recursive access to
-		/// `value`. Note that recursive sets will still deadlock because the
-		/// underlying producer prevents sending recursive events.
-		box = PropertyBox(initialValue)
+	/// Initializes a mutable property that first takes on `initialValue`, and
+	/// notifies its observers only of changes that are not equivalent to the
+	/// previous value.
+	///
+	/// The previous and the new value are compared as part of the modification, so
+	/// a write of an equivalent value does not send any event.
+	///
+	/// - note: The previous value is retained during the modification. If `Value`
+	///         is a copy-on-write type, in-place mutations would copy the storage.
+	///
+	/// - parameters:
+	///   - initialValue: Starting value for the mutable property.
+	///   - isEquivalent: A closure to determine whether two values are equivalent.
+	public convenience init(_ initialValue: Value, skipsRepeats isEquivalent: @escaping (Value, Value) -> Bool) {
+		self.init(initialValue, isEquivalent: isEquivalent)
 	}
 
 	/// Initializes a mutable property that first takes on `initialValue`
@@ -769,6 +917,28 @@ public final class MutableProperty<Value>: ComposableMutablePropertyProtocol {
 		self.init(wrappedValue)
 	}
 
+	/// Initializes a mutable property that first takes on `initialValue`, and
+	/// notifies its observers only of changes that are not equivalent to the
+	/// previous value.
+	///
+	/// - parameters:
+	///   - initialValue: Starting value for the mutable property.
+	///   - isEquivalent: A closure to determine whether two values are equivalent.
+	public convenience init(wrappedValue: Value, skipsRepeats isEquivalent: @escaping (Value, Value) -> Bool) {
+		self.init(wrappedValue, skipsRepeats: isEquivalent)
+	}
+
+	private init(_ initialValue: Value, isEquivalent: ((Value, Value) -> Bool)?) {
+		(signal, observer) = Signal.pipe()
+		(lifetime, token) = Lifetime.make()
+
+		/// Need a recursive lock around `value` to allow recursive access to
+		/// `value`. Note that recursive sets will still deadlock because the
+		/// underlying producer prevents sending recursive events.
+		box = PropertyBox(initialValue)
+		self.isEquivalent = isEquivalent
+	}
+
 	/// Atomically replaces the contents of the variable.
 	///
 	/// - parameters:
@@ -792,11 +962,40 @@ public final class MutableProperty<Value>: ComposableMutablePropertyProtocol {
 	@discardableResult
 	public func modify<Result>(_ action: (inout Value) throws -> Result) rethrows -> Result {
 		return try box.begin { storage in
-			defer { observer.send(value: storage.value) }
+			guard let isEquivalent = isEquivalent else {
+				defer { didModify(storage) }
+				return try storage.modify(action)
+			}
+
+			let oldValue = storage.value
+			defer {
+				if !isEquivalent(oldValue, storage.value) {
+					didModify(storage)
+				}
+			}
 			return try storage.modify(action)
 		}
 	}
 
+	/// Propagate the new value to the observers, or defer it if a transaction is
+	/// open on the current thread.
+	///
+	/// - precondition: Must be called within `box.begin`.
+	///
+	/// - parameters:
+	///   - storage: The property storage.
+	private func didModify(_ storage: PropertyStorage<Value>) {
+		if let transaction = PropertyTransaction.open {
+			transaction.enqueue(box, height: 0) { [box, observer] in
+				box.begin { storage in observer.send(value: storage.value) }
+			}
+		} else if box.hasComposedDependents {
+			PropertyTransaction.propagate { observer.send(value: storage.value) }
+		} else {
+			observer.send(value: storage.value)
+		}
+	}
+
 	/// Atomically modifies the variable.
 	///
 	/// - warning: The reference should not be escaped.
@@ -823,10 +1022,406 @@ public final class MutableProperty<Value>: ComposableMutablePropertyProtocol {
 	}
 
 	deinit {
+		PropertyTransaction.current?.flushIfPending(box)
 		observer.sendCompleted()
 	}
 }
 
+/// A transaction batches changes to `MutableProperty`s made on the current thread,
+/// and propagates them to the dependent composed properties as one update when
+/// the transaction commits.
+///
+/// Within a transaction, a `MutableProperty` has its value updated immediately,
+/// but defers sending it to its observers until the commit. If a property is
+/// modified more than once, only its latest value is sent.
+///
+/// When committing, the changes are propagated in the order of the heights of
+/// the properties in the property graph. A composed property emits at most once,
+/// and only after all the properties it depends on have propagated their changes.
+/// So it would never observe an inconsistent mix of old and new values.
+///
+/// ```
+/// let firstName = MutableProperty("John")
+/// let lastName = MutableProperty("Appleseed")
+/// let fullName = Property.combineLatest(firstName, lastName).map { "\($0) \($1)" }
+///
+/// PropertyTransaction.perform {
+///     firstName.value = "Jane"
+///     lastName.value = "Doe"
+/// }
+/// // `fullName` emits "Jane Doe" only.
+/// ```
+///
+/// A change made outside of a transaction is propagated the same way, as if it is
+/// the only change of an implicit transaction: the observers of the property
+/// receive it first, and the dependent composed properties emit in topological
+/// order before the change returns.
+///
+/// - note: A transaction is confined to the thread that started it. Changes made
+///         on other threads are not affected.
+public final class PropertyTransaction {
+	private enum Phase {
+		case open
+		case committing
+	}
+
+	private var phase: Phase
+
+	/// The pending deliveries, keyed by their nodes. `serial` identifies the entry
+	/// of `queue` which is still valid for the node.
+	private var pending: [ObjectIdentifier: (serial: Int, flush: () -> Void)]
+
+	/// A binary min-heap of the pending deliveries ordered by height, and then by
+	/// the order of enqueueing. Entries of deliveries which have been flushed or
+	/// cancelled are left in the heap, and skipped when popped.
+	private var queue: [(height: Int, serial: Int, id: ObjectIdentifier)]
+	private var nextSerial: Int
+
+	/// The transaction which was active on the thread when `self` started.
+	private let outer: PropertyTransaction?
+
+	private init(_ phase: Phase, outer: PropertyTransaction?) {
+		self.phase = phase
+		self.outer = outer
+		pending = [:]
+		queue = []
+		nextSerial = 0
+	}
+
+	/// Perform the given action in a transaction. If the current thread is already
+	/// in a transaction, the action joins the outer transaction.
+	///
+	/// - parameters:
+	///   - action: A closure that modifies properties.
+	///
+	/// - returns: The result of the action.
+	@discardableResult
+	public static func perform<Result>(_ action: () throws -> Result) rethrows -> Result {
+		let context = PropertyThreadContext.current
+
+		if context.transaction?.phase == .open {
+			return try action()
+		}
+
+		let outer = context.transaction
+		let transaction = PropertyTransaction(.open, outer: outer)
+		context.transaction = transaction
+
+		defer {
+			transaction.commit()
+			context.transaction = outer
+		}
+
+		return try action()
+	}
+
+	/// Propagate a change made outside of any open transaction. The composed
+	/// properties affected by `send` are flushed in topological order before it
+	/// returns.
+	///
+	/// - parameters:
+	///   - send: The action delivering the change.
+	internal static func propagate(_ send: () -> Void) {
+		let context = PropertyThreadContext.current
+		let outer = context.transaction
+		let transaction = PropertyTransaction(.committing, outer: outer)
+		context.transaction = transaction
+
+		defer { context.transaction = outer }
+
+		send()
+		transaction.commit()
+	}
+
+	/// The transaction of the current thread, if any.
+	internal static var current: PropertyTransaction? {
+		return PropertyThreadContext.currentIfExists?.transaction
+	}
+
+	/// The transaction of the current thread, if it is accepting changes.
+	internal static var open: PropertyTransaction? {
+		guard let transaction = current, transaction.phase == .open else { return nil }
+		return transaction
+	}
+
+	/// The transaction of the current thread, if it is being committed.
+	internal static var committing: PropertyTransaction? {
+		guard let transaction = current, transaction.phase == .committing else { return nil }
+		return transaction
+	}
+
+	/// Enqueue the delivery of the latest value of the given node. It is a no-op if
+	/// the node has a pending delivery already.
+	///
+	/// If any outer transaction has a pending delivery of the node, the delivery
+	/// is taken over by `self`.
+	///
+	/// - parameters:
+	///   - node: The identity of the node.
+	///   - height: The height of the node in the property graph.
+	///   - flush: The action delivering the latest value of the node.
+	internal func enqueue(_ node: AnyObject, height: Int, flush: @escaping () -> Void) {
+		let id = ObjectIdentifier(node)
+		guard pending[id] == nil else { return }
+
+		pending[id] = (nextSerial, flush)
+		push((height, nextSerial, id))
+		nextSerial += 1
+		outer?.cancel(id)
+	}
+
+	/// Whether the given node has a pending delivery in `self` or any outer
+	/// transaction.
+	///
+	/// - parameters:
+	///   - node: The identity of the node.
+	internal func hasPending(_ node: AnyObject) -> Bool {
+		return pending[ObjectIdentifier(node)] != nil || outer?.hasPending(node) == true
+	}
+
+	/// Perform the pending delivery of the given node immediately, if any.
+	///
+	/// - parameters:
+	///   - node: The identity of the node.
+	internal func flushIfPending(_ node: AnyObject) {
+		if let entry = pending.removeValue(forKey: ObjectIdentifier(node)) {
+			entry.flush()
+		} else {
+			outer?.flushIfPending(node)
+		}
+	}
+
+	private func cancel(_ id: ObjectIdentifier) {
+		if pending.removeValue(forKey: id) == nil {
+			outer?.cancel(id)
+		}
+	}
+
+	private func commit() {
+		phase = .committing
+
+		// Nodes enqueued during the commit always have a greater height than the
+		// node being flushed, so picking the lowest height first yields a
+		// topological order.
+		while let top = popMin() {
+			guard let entry = pending[top.id], entry.serial == top.serial else { continue }
+			pending.removeValue(forKey: top.id)
+			entry.flush()
+		}
+	}
+
+	private func precedes(_ left: Int, _ right: Int) -> Bool {
+		return (queue[left].height, queue[left].serial) < (queue[right].height, queue[right].serial)
+	}
+
+	private func push(_ element: (height: Int, serial: Int, id: ObjectIdentifier)) {
+		queue.append(element)
+
+		var index = queue.count - 1
+		while index > 0 {
+			let parent = (index - 1) / 2
+			guard precedes(index, parent) else { break }
+			queue.swapAt(index, parent)
+			index = parent
+		}
+	}
+
+	private func popMin() -> (height: Int, serial: Int, id: ObjectIdentifier)? {
+		guard !queue.isEmpty else { return nil }
+
+		queue.swapAt(0, queue.count - 1)
+		let top = queue.removeLast()
+
+		var index = 0
+		while true {
+			let left = 2 * index + 1
+			let right = left + 1
+			var smallest = index
+
+			if left < queue.count && precedes(left, smallest) {
+				smallest = left
+			}
+			if right < queue.count && precedes(right, smallest) {
+				smallest = right
+			}
+			guard smallest != index else { break }
+
+			queue.swapAt(index, smallest)
+			index = smallest
+		}
+
+		return top
+	}
+}
+
+/// The per-thread state of the property graph.
+internal final class PropertyThreadContext {
+	private static let key: pthread_key_t = {
+		var key = pthread_key_t()
+		let status = pthread_key_create(&key) { pointer in
+			#if os(Linux)
+			guard let pointer = pointer else { return }
+			#endif
+			Unmanaged<PropertyThreadContext>.fromOpaque(pointer).release()
+		}
+		precondition(status == 0, "Unexpected pthread key error code: \(status)")
+		return key
+	}()
+
+	/// The context of the current thread, created on demand.
+	static var current: PropertyThreadContext {
+		if let context = currentIfExists {
+			return context
+		}
+
+		let context = PropertyThreadContext()
+		pthread_setspecific(key, Unmanaged.passRetained(context).toOpaque())
+		return context
+	}
+
+	/// The context of the current thread, if it has been created.
+	static var currentIfExists: PropertyThreadContext? {
+		return pthread_getspecific(key).map { Unmanaged<PropertyThreadContext>.fromOpaque($0).takeUnretainedValue() }
+	}
+
+	/// The active transaction of the thread.
+	var transaction: PropertyTransaction?
+
+	/// The maximum heights reported by the properties started in each composed
+	/// property being initialized on the thread.
+	private var collectedHeights: [Int] = []
+
+	private init() {}
+
+	/// Start collecting the heights of the properties being started.
+	func beginCollectingHeight() {
+		collectedHeights.append(0)
+	}
+
+	/// Stop collecting the heights of the properties being started.
+	///
+	/// - returns: The height of a property depending on the started properties.
+	func endCollectingHeight() -> Int {
+		return collectedHeights.removeLast() + 1
+	}
+
+	/// Report the height of a property whose producer is being started.
+	///
+	/// - parameters:
+	///   - height: The height of the property.
+	///
+	/// - returns: `true` if the producer is being started by a composed property.
+	@discardableResult
+	static func reportHeight(_ height: Int) -> Bool {
+		guard let context = currentIfExists, !context.collectedHeights.isEmpty else { return false }
+		context.collectedHeights[context.collectedHeights.count - 1] = max(context.collectedHeights[context.collectedHeights.count - 1], height)
+		return true
+	}
+}
+
+/// `PropertyProducerCore` backs the producers of `MutableProperty` and composed
+/// properties.
+///
+/// Every produced signal relays the events of the property's relay signal, which
+/// the core observes directly. Unlike a closure-based producer, a start does not
+/// involve a start handler, a `Lifetime`, or an observer that maps `interrupted`
+/// to `completed`.
+private final class PropertyProducerCore<Storage, Value>: SignalProducerCore<Value, Never> {
+	private let box: PropertyBox<Storage>
+	private let relay: Signal<Value, Never>
+	private let currentValue: (PropertyStorage<Storage>) -> Value
+
+	init(box: PropertyBox<Storage>, relay: Signal<Value, Never>, currentValue: @escaping (PropertyStorage<Storage>) -> Value) {
+		self.box = box
+		self.relay = relay
+		self.currentValue = currentValue
+	}
+
+	override func makeInstance() -> Instance {
+		let disposable = SerialDisposable()
+		let (signal, observer) = Signal<Value, Never>.pipe(disposable: disposable)
+
+		return Instance(signal: signal,
+		                observerDidSetup: { self.attach(observer, to: disposable) },
+		                interruptHandle: AnyDisposable(observer.sendInterrupted))
+	}
+
+	@discardableResult
+	override func start(_ generator: (Disposable) -> Signal<Value, Never>.Observer) -> Disposable {
+		let disposable = SerialDisposable()
+		let (signal, observer) = Signal<Value, Never>.pipe(disposable: disposable)
+		let interruptHandle = AnyDisposable(observer.sendInterrupted)
+
+		signal.observe(generator(interruptHandle))
+		attach(observer, to: disposable)
+
+		return interruptHandle
+	}
+
+	/// Send the current value to `observer`, and then forward the changes of the
+	/// property to it, atomically with respect to writers.
+	///
+	/// - parameters:
+	///   - observer: The observer of a produced signal.
+	///   - disposable: The disposable of the produced signal, which receives the
+	///                 observation of the relay signal.
+	private func attach(_ observer: Signal<Value, Never>.Observer, to disposable: SerialDisposable) {
+		box.begin { storage in
+			if PropertyThreadContext.reportHeight(box.height) {
+				box.hasComposedDependents = true
+			}
+			observer.send(value: currentValue(storage))
+
+			// If the property has a delivery pending in a transaction, `observer` has
+			// just received the value it would flush. So the flushed value is skipped,
+			// unless the property has been modified since.
+			var relayObserver = observer
+			if PropertyTransaction.current?.hasPending(box) == true {
+				let attachedVersion = box.version
+				var isSkipping = true
+
+				relayObserver = Signal<Value, Never>.Observer { [box] event in
+					if isSkipping, case .value = event {
+						isSkipping = false
+						if box.version == attachedVersion { return }
+					}
+					observer.send(event)
+				}
+			}
+
+			// The relay signal does not emit `interrupted`, and it terminates only
+			// when the property deinitializes. So a terminated relay is equivalent to
+			// a completed one.
+			if let observation = relay.observeIfAlive(relayObserver) {
+				disposable.inner = observation
+			} else {
+				observer.sendCompleted()
+			}
+		}
+	}
+}
+
+/// The storage of a lazily evaluated composed property.
+private enum LazyPropertyValue<Source, Value> {
+	/// The source has changed, and the value has not yet been evaluated.
+	case outdated(Source)
+
+	/// The value has been evaluated from the latest source value.
+	case evaluated(Value)
+}
+
+extension MutableProperty where Value: Equatable {
+	/// Initializes a mutable property that first takes on `initialValue`, and
+	/// notifies its observers only of changes that are not equal to the previous
+	/// value.
+	///
+	/// - parameters:
+	///   - initialValue: Starting value for the mutable property.
+	public convenience init(skippingRepeats initialValue: Value) {
+		self.init(initialValue, skipsRepeats: ==)
+	}
+}
+
 internal struct PropertyStorage<Value> {
 	private unowned let box: PropertyBox<Value>
 
@@ -838,7 +1433,7 @@ internal struct PropertyStorage<Value> {
 		guard !box.isModifying else { fatalError("Nested modifications violate exclusivity of access.") }
 		box.isModifying = true
 		defer { box.isModifying = false }
-		return try action(&box._value)
+		return try box.mutate(action)
 	}
 
 	fileprivate init(_ box: PropertyBox<Value>) {
@@ -848,23 +1443,61 @@ internal struct PropertyStorage<Value> {
 
 /// A reference counted box which holds a recursive lock and a value storage.
 ///
+/// Writers are serialized by the recursive `lock`, which is held throughout a
+/// `begin` transaction, including the observer call-outs. Plain reads of `value`
+/// bypass it, and instead synchronize with writers only through `readLock`, which
+/// is held just for the load of the value, or the store of a new value. So readers
+/// are not blocked by an on-going event delivery.
+///
+/// A modification moves the value out of the storage, so that copy-on-write values
+/// are mutated in place. Readers arriving in the meantime wait for the writer
+/// through `lock`. Reading the value from within its own modification is a
+/// violation of exclusive access, and traps.
+///
 /// The requirement of a `Value?` storage from composed properties prevents further
 /// implementation sharing with `MutableProperty`.
-private final class PropertyBox<Value> {
+internal final class PropertyBox<Value> {
 
-	private let lock: Lock.PthreadLock
-	fileprivate var _value: Value
+	private let lock: Lock
+	private let readLock: Lock
 	fileprivate var isModifying = false
 
+	/// The value, which is `nil` only while a modification is in progress.
+	private var storage: Value?
+
+	/// The height of the owning property in the property graph. A
+	/// `MutableProperty` has a height of zero.
+	fileprivate private(set) var height = 0
+
+	/// Whether a composed property has ever started the producer of the owning
+	/// property. Changes of a `MutableProperty` without composed dependents are
+	/// sent directly, with no implicit transaction. It is guarded by `lock`.
+	fileprivate var hasComposedDependents = false
+
+	/// The number of mutations of the storage, which is guarded by `lock`.
+	fileprivate private(set) var version = 0
+
 	internal var value: Value {
-		lock.lock()
-		defer { lock.unlock() }
-		return _value
+		readLock.lock()
+		let value = storage
+		readLock.unlock()
+
+		// The value has been moved out by a modification in progress.
+		return value ?? withValue { $0 }
+	}
+
+	/// The value, which may be accessed only with `lock` acquired.
+	fileprivate var _value: Value {
+		guard let value = storage else {
+			fatalError("The value of a property cannot be read within its own modification.")
+		}
+		return value
 	}
 
 	init(_ value: Value) {
-		_value = value
-		lock = Lock.PthreadLock(recursive: true)
+		storage = value
+		lock = Lock.makeRecursive("PropertyBox.lock")
+		readLock = Lock.make("PropertyBox.readLock")
 	}
 
 	func withValue<Result>(_ action: (Value) throws -> Result) rethrows -> Result {
@@ -878,4 +1511,38 @@ private final class PropertyBox<Value> {
 		defer { lock.unlock() }
 		return try action(PropertyStorage(self))
 	}
+
+	/// Perform the given action under the lock guarding the reads of `value`. The
+	/// action must not access `value`.
+	fileprivate func withReadLock<Result>(_ action: () -> Result) -> Result {
+		readLock.lock()
+		defer { readLock.unlock() }
+		return action()
+	}
+
+	fileprivate func setHeight(_ height: Int) {
+		lock.lock()
+		defer { lock.unlock() }
+		self.height = height
+	}
+
+	/// Mutate the storage in place. The value is moved out of the storage for the
+	/// duration of the action, and stored back when the action returns.
+	///
+	/// - precondition: `lock` must have been acquired by the caller.
+	fileprivate func mutate<Result>(_ action: (inout Value) throws -> Result) rethrows -> Result {
+		readLock.lock()
+		var value = _value
+		storage = nil
+		readLock.unlock()
+
+		defer {
+			version &+= 1
+			readLock.lock()
+			storage = value
+			readLock.unlock()
+		}
+
+		return try action(&value)
+	}
 }
@@ -0,0 +1,124 @@
+import Foundation
+
+/// Determines the delay before every retry of `retry(upTo:backoff:budget:on:when:)`.
+public struct RetryBackoff {
+	private let initial: TimeInterval
+	private let multiplier: Double
+	private let maximum: TimeInterval
+	private let jitter: Double
+	private let random: () -> Double
+
+	private init(initial: TimeInterval, multiplier: Double, maximum: TimeInterval, jitter: Double, random: @escaping () -> Double) {
+		precondition(initial >= 0)
+		precondition(multiplier >= 1)
+		precondition(maximum >= initial)
+		precondition(jitter >= 0 && jitter <= 1)
+
+		self.initial = initial
+		self.multiplier = multiplier
+		self.maximum = maximum
+		self.jitter = jitter
+		self.random = random
+	}
+
+	/// Delay every retry by the same interval.
+	///
+	/// - parameters:
+	///   - interval: The interval before every retry.
+	///
+	/// - returns: A backoff of a constant interval.
+	public static func constant(_ interval: TimeInterval) -> RetryBackoff {
+		return RetryBackoff(initial: interval, multiplier: 1, maximum: interval, jitter: 0, random: { 0 })
+	}
+
+	/// Multiply the delay by `multiplier` after every retry, up to `maximum`.
+	///
+	/// With a non-zero `jitter`, every delay is shortened by a random fraction of up to
+	/// `jitter` of itself, so that the retries of producers which have failed at the
+	/// same time are spread out.
+	///
+	/// - precondition: `multiplier` must be at least 1, `maximum` must be at least
+	///                 `initial`, and `jitter` must be between 0 and 1.
+	///
+	/// - parameters:
+	///   - initial: The interval before the first retry.
+	///   - multiplier: The factor by which the interval grows after every retry.
+	///   - maximum: The maximum interval before a retry.
+	///   - jitter: The maximum fraction by which a delay is shortened.
+	///   - random: A closure returning a random number in `0 ..< 1`, which determines
+	///             the jitter of a delay.
+	///
+	/// - returns: An exponential backoff.
+	public static func exponential(
+		initial: TimeInterval,
+		multiplier: Double = 2,
+		maximum: TimeInterval = .infinity,
+		jitter: Double = 0,
+		random: @escaping () -> Double = { Double.random(in: 0 ..< 1) }
+	) -> RetryBackoff {
+		return RetryBackoff(initial: initial, multiplier: multiplier, maximum: maximum, jitter: jitter, random: random)
+	}
+
+	/// The delay before a retry.
+	///
+	/// - parameters:
+	///   - retry: The number of the retry, starting at 1.
+	///
+	/// - returns: The delay in seconds.
+	internal func delay(beforeRetry retry: Int) -> TimeInterval {
+		let delay = min(initial * pow(multiplier, Double(retry - 1)), maximum)
+		return jitter > 0 ? delay * (1 - jitter * random()) : delay
+	}
+}
+
+/// A budget of retries shared by producers, which stops them from retrying once the
+/// budget is exhausted, e.g. while a remote service is failing every request.
+///
+/// Every retry spends a token. Every producer started deposits `depositPerStart`
+/// tokens, up to `capacity`, so that the budget recovers as producers keep being
+/// started, and the retries are limited to a fraction of the starts.
+public final class RetryBudget {
+	private let capacity: Double
+	private let depositPerStart: Double
+	private let tokens: Atomic<Double>
+
+	/// The number of retries which can be made.
+	public var remainingRetries: Int {
+		return Int(tokens.value)
+	}
+
+	/// Create a budget.
+	///
+	/// - precondition: `capacity` and `depositPerStart` must be non-negative.
+	///
+	/// - parameters:
+	///   - capacity: The number of tokens the budget starts with, and the maximum it
+	///               can hold.
+	///   - depositPerStart: The number of tokens deposited by every producer started.
+	public init(capacity: Int, depositPerStart: Double = 0) {
+		precondition(capacity >= 0)
+		precondition(depositPerStart >= 0)
+
+		self.capacity = Double(capacity)
+		self.depositPerStart = depositPerStart
+		self.tokens = Atomic(Double(capacity))
+	}
+
+	/// Deposit the tokens of a producer being started.
+	internal func deposit() {
+		guard depositPerStart > 0 else { return }
+		tokens.modify { $0 = min($0 + depositPerStart, capacity) }
+	}
+
+	/// Spend the token of a retry.
+	///
+	/// - returns: `true` if the retry can be made, or `false` if the budget has been
+	///            exhausted.
+	internal func withdraw() -> Bool {
+		return tokens.modify { tokens in
+			guard tokens >= 1 else { return false }
+			tokens -= 1
+			return true
+		}
+	}
+}
@@ -225,6 +225,14 @@ public final class QueueScheduler: DateScheduler {
 	internal init(internalQueue: DispatchQueue) {
 		queue = internalQueue
 		timers = Atomic(Set())
+
+		if isMemoryAccountingEnabled {
+			MemoryAccounting.track(self, kind: "QueueScheduler") { scheduler in
+				MemoryEstimate.object(storedBytes: MemoryLayout<(DispatchQueue, Atomic<Set<DispatchSourceTimerWrapper>>)>.size)
+					+ scheduler.timers.estimatedFootprint
+					+ scheduler.timers.withValue { MemoryEstimate.set($0) + $0.count * MemoryEstimate.object(storedBytes: MemoryLayout<DispatchSourceTimer>.size) }
+			}
+		}
 	}
 
 	/// Initializes a scheduler that will target the given queue with its
@@ -427,6 +435,22 @@ public final class TestScheduler: DateScheduler {
 	public init(startDate: Date = Date(timeIntervalSinceReferenceDate: 0)) {
 		lock.name = "org.reactivecocoa.ReactiveSwift.TestScheduler"
 		_currentDate = startDate
+
+		if isMemoryAccountingEnabled {
+			MemoryAccounting.track(self, kind: "TestScheduler") { $0.estimatedFootprint }
+		}
+	}
+
+	/// The estimated bytes held by the scheduler, including its queue of scheduled
+	/// actions.
+	private var estimatedFootprint: Int {
+		lock.lock()
+		defer { lock.unlock() }
+
+		let action = MemoryEstimate.object(storedBytes: MemoryLayout<Date>.size + MemoryLayout<() -> Void>.size)
+		return MemoryEstimate.object(storedBytes: MemoryLayout<(NSRecursiveLock, Date, [ScheduledAction])>.size)
+			+ MemoryEstimate.array(scheduledActions)
+			+ scheduledActions.count * action
 	}
 
 	private func schedule(_ action: ScheduledAction) -> Disposable {
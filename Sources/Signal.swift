@@ -45,7 +45,7 @@ public final class Signal<Value, Error: Swift.Error> {
 	/// ```
 	private let core: Core
 
-	private final class Core {
+	private final class Core: SignalGraphInspectable {
 		/// The disposable associated with the signal.
 		///
 		/// Disposing of `disposable` is assumed to remove the generator
@@ -63,17 +63,30 @@ public final class Signal<Value, Error: Swift.Error> {
 		private let sendLock: Lock
 
 		fileprivate init(_ generator: (Observer, Lifetime) -> Void) {
-			state = .alive(Bag(), hasDeinitialized: false)
+			state = .alive(ObserverBag(), hasDeinitialized: false)
 
-			stateLock = Lock.make()
-			sendLock = Lock.make()
+			stateLock = Lock.make("Signal.Core.stateLock")
+			sendLock = Lock.make("Signal.Core.sendLock")
 			disposable = CompositeDisposable()
 
+			if isSignalGraphEnabled {
+				SignalGraph.register(self, label: "\(Signal<Value, Error>.self)")
+			}
+
+			if isMemoryAccountingEnabled {
+				MemoryAccounting.track(self, kind: "Signal") { $0.estimatedFootprint }
+			}
+
 			// The generator observer retains the `Signal` core.
 			generator(Observer(action: self.send, interruptsOnDeinit: true), Lifetime(disposable))
 		}
 
 		private func send(_ event: Event) {
+			let tracingSession = signalTracingSession.load()
+			if tracingSession != 0 {
+				SignalTracing.record(signal: self, kind: SignalTraceRecord.Kind(event), session: tracingSession)
+			}
+
 			if event.isTerminating {
 				// Recursive events are disallowed for `value` events, but are permitted
 				// for termination events. Specifically:
@@ -111,8 +124,16 @@ public final class Signal<Value, Error: Swift.Error> {
 				if case let .alive(observers, _) = self.state {
 					self.stateLock.unlock()
 
-					for observer in observers {
-						observer.send(event)
+					if isSignalMetricsEnabled {
+						let start = SignalMetrics.now()
+						for observer in observers {
+							observer.send(event)
+						}
+						SignalMetrics.delivery.record(.value, since: start)
+					} else {
+						for observer in observers {
+							observer.send(event)
+						}
 					}
 				} else {
 					self.stateLock.unlock()
@@ -152,25 +173,85 @@ public final class Signal<Value, Error: Swift.Error> {
 		/// - returns: A `Disposable` which can be used to disconnect the observer,
 		///            or `nil` if the signal has already terminated.
 		fileprivate func observe(_ observer: Observer) -> Disposable? {
-			var token: Bag<Observer>.Token?
+			guard let disposable = observeIfAlive(observer) else {
+				observer.sendInterrupted()
+				return nil
+			}
+			return disposable
+		}
+
+		/// Observe the Signal by sending any future events to the given observer,
+		/// if the signal has not yet terminated.
+		///
+		/// - parameters:
+		///   - observer: An observer to forward the events to.
+		///
+		/// - returns: A `Disposable` which can be used to disconnect the observer,
+		///            or `nil` if the signal has already terminated.
+		fileprivate func observeIfAlive(_ observer: Observer) -> Disposable? {
+			var token: ObserverBag<Observer>.Token?
 
 			stateLock.lock()
 
-			if case let .alive(observers, hasDeinitialized) = state {
-				var newObservers = observers
-				token = newObservers.insert(observer)
-				self.state = .alive(newObservers, hasDeinitialized: hasDeinitialized)
+			if case .alive(var observers, let hasDeinitialized) = state {
+				// Release the reference held by `state`, so that `observers` can be
+				// mutated in place unless it is being iterated by a sender.
+				state = .terminated
+				token = observers.insert(observer)
+				state = .alive(observers, hasDeinitialized: hasDeinitialized)
 			}
 
 			stateLock.unlock()
 
-			if let token = token {
-				return AnyDisposable { [weak self] in
+			return token.map { token in
+				AnyDisposable { [weak self] in
 					self?.removeObserver(with: token)
 				}
-			} else {
-				observer.sendInterrupted()
-				return nil
+			}
+		}
+
+		/// Whether the signal is alive and has at least one observer.
+		fileprivate var hasObservers: Bool {
+			stateLock.lock()
+			defer { stateLock.unlock() }
+
+			if case let .alive(observers, _) = state {
+				return !observers.isEmpty
+			}
+			return false
+		}
+
+		/// The estimated bytes held by the signal, including its observer bag, locks
+		/// and disposable, and excluding the observers.
+		fileprivate var estimatedFootprint: Int {
+			stateLock.lock()
+			let observers: Int
+			switch state {
+			case let .alive(bag, _), let .terminating(bag, _):
+				observers = bag.estimatedFootprint
+			case .terminated:
+				observers = 0
+			}
+			stateLock.unlock()
+
+			return MemoryEstimate.object(storedBytes: MemoryLayout<(CompositeDisposable, State, Lock, Lock)>.size)
+				+ observers
+				+ stateLock.estimatedFootprint
+				+ sendLock.estimatedFootprint
+				+ disposable.estimatedFootprint
+		}
+
+		fileprivate var graphState: (status: SignalGraphNode.Status, observerCount: Int) {
+			stateLock.lock()
+			defer { stateLock.unlock() }
+
+			switch state {
+			case let .alive(observers, hasDeinitialized):
+				return (hasDeinitialized ? .unretained : .alive, observers.count)
+			case let .terminating(observers, _):
+				return (.terminating, observers.count)
+			case .terminated:
+				return (.terminated, 0)
 			}
 		}
 
@@ -178,13 +259,15 @@ public final class Signal<Value, Error: Swift.Error> {
 		///
 		/// - parameters:
 		///   - token: The token of the observer to remove.
-		private func removeObserver(with token: Bag<Observer>.Token) {
+		private func removeObserver(with token: ObserverBag<Observer>.Token) {
 			stateLock.lock()
 
-			if case let .alive(observers, hasDeinitialized) = state {
-				var newObservers = observers
-				let observer = newObservers.remove(using: token)
-				self.state = .alive(newObservers, hasDeinitialized: hasDeinitialized)
+			if case .alive(var observers, let hasDeinitialized) = state {
+				// Release the reference held by `state`, so that `observers` can be
+				// mutated in place unless it is being iterated by a sender.
+				state = .terminated
+				let observer = observers.remove(using: token)
+				state = .alive(observers, hasDeinitialized: hasDeinitialized)
 
 				// Ensure `observer` is deallocated after `stateLock` is
 				// released to avoid deadlocks.
@@ -257,7 +340,7 @@ public final class Signal<Value, Error: Swift.Error> {
 					return
 				}
 
-				self.state = .terminating(Bag(), .silent)
+				self.state = .terminating(ObserverBag(), .silent)
 				stateLock.unlock()
 
 				tryToCommitTermination()
@@ -314,6 +397,29 @@ public final class Signal<Value, Error: Swift.Error> {
 		return core.observe(observer)
 	}
 
+	/// Observe `self` by sending any future events to the given observer, if `self`
+	/// has not yet terminated.
+	///
+	/// - note: Unlike `observe(_:)`, the observer would not receive an `interrupted`
+	///         event if `self` has already terminated.
+	///
+	/// - parameters:
+	///   - observer: An observer to forward the events to.
+	///
+	/// - returns: A `Disposable` which can be used to disconnect the observer,
+	///            or `nil` if the signal has already terminated.
+	internal func observeIfAlive(_ observer: Observer) -> Disposable? {
+		return core.observeIfAlive(observer)
+	}
+
+	/// Whether `self` is alive and has at least one observer.
+	///
+	/// - note: The result can be outdated as soon as it is returned, if `self` is
+	///         being observed or disposed of concurrently.
+	internal var hasObservers: Bool {
+		return core.hasObservers
+	}
+
 	deinit {
 		core.signalDidDeinitialize()
 	}
@@ -362,11 +468,11 @@ public final class Signal<Value, Error: Swift.Error> {
 		}
 
 		/// The `Signal` is alive.
-		case alive(Bag<Observer>, hasDeinitialized: Bool)
+		case alive(ObserverBag<Observer>, hasDeinitialized: Bool)
 
 		/// The `Signal` has received a termination event, and is about to be
 		/// terminated.
-		case terminating(Bag<Observer>, TerminationKind)
+		case terminating(ObserverBag<Observer>, TerminationKind)
 
 		/// The `Signal` has terminated.
 		case terminated
@@ -535,16 +641,28 @@ extension Signal {
 	/// - parameters:
 	///   - transform: A closure that creates the said action from the given event
 	///                closure.
+	///   - name: The name of the operator, which identifies the stage in
+	///           `SignalMetrics`.
 	///
 	/// - returns: A signal that forwards events yielded by the action.
-	internal func flatMapEvent<U, E>(_ transform: @escaping Event.Transformation<U, E>) -> Signal<U, E> {
-		return Signal<U, E> { output, lifetime in
+	internal func flatMapEvent<U, E>(_ transform: @escaping Event.Transformation<U, E>, name: StaticString = #function) -> Signal<U, E> {
+		let signal = Signal<U, E> { output, lifetime in
 			// Create an input sink whose events would go through the given
 			// event transformation, and have the resulting events propagated
 			// to the resulting `Signal`.
-			let input = transform(output, lifetime)
+			let input = SignalMetrics.instrument(transform, type: "Signal", name: name)(output, lifetime)
 			lifetime += self.observe(input.assumeUnboundDemand())
 		}
+
+		if isSignalGraphEnabled {
+			SignalGraph.link(
+				from: core, "\(Signal<Value, Error>.self)",
+				to: signal.core, "\(Signal<U, E>.self)",
+				operator: "\(name)"
+			)
+		}
+
+		return signal
 	}
 
 	/// Map each value in the signal to a new value.
@@ -1779,9 +1897,14 @@ extension Signal {
 
 		private let action: (AggregateStrategyEvent) -> Void
 
+		/// The gauge of the buffered values, if metrics were enabled when the
+		/// strategy was created.
+		private let buffered: SignalMetricsGauge?
+
 		func update(_ value: Any, at position: Int) {
 			stateLock.lock()
 			values[position].append(value)
+			buffered?.add(1)
 
 			if canEmit {
 				var buffer = ContiguousArray<Any>()
@@ -1790,6 +1913,7 @@ extension Signal {
 				for index in values.indices {
 					buffer.append(values[index].removeFirst())
 				}
+				buffered?.add(-values.count)
 
 				let shouldComplete = areAllCompleted || hasCompletedAndEmptiedSignal
 				sendLock.lock()
@@ -1839,8 +1963,30 @@ extension Signal {
 			self.hasConcurrentlyCompleted = false
 			self.isCompleted = ContiguousArray(repeating: false, count: count)
 			self.action = action
+			self.buffered = SignalMetrics.gauge(named: "zip")
 			self.sendLock = Lock.make()
 			self.stateLock = Lock.make()
+
+			if isMemoryAccountingEnabled {
+				MemoryAccounting.track(self, kind: "zip") { $0.estimatedFootprint }
+			}
+		}
+
+		/// The estimated bytes held by the strategy, including the buffered values.
+		private var estimatedFootprint: Int {
+			stateLock.lock()
+			defer { stateLock.unlock() }
+
+			return MemoryEstimate.object(storedBytes: MemoryLayout<(Lock, Lock, ContiguousArray<[Any]>, Bool, ContiguousArray<Bool>, (AggregateStrategyEvent) -> Void, SignalMetricsGauge?)>.size)
+				+ MemoryEstimate.array(values)
+				+ values.reduce(0) { $0 + MemoryEstimate.array($1) }
+				+ MemoryEstimate.array(isCompleted)
+				+ stateLock.estimatedFootprint
+				+ sendLock.estimatedFootprint
+		}
+
+		deinit {
+			buffered?.add(-values.reduce(0) { $0 + $1.count })
 		}
 	}
 
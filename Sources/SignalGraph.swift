@@ -0,0 +1,275 @@
+import Dispatch
+import Foundation
+
+/// The switch of `SignalGraph`, which is nonzero while `Signal`s register themselves.
+/// It is written only with the registry lock acquired.
+private let signalGraphSwitch = AtomicInt32(0)
+
+/// Whether `Signal`s register themselves in the graph registry. It is read whenever
+/// a `Signal` is created, so that the registry costs a single atomic load and branch
+/// when it is disabled.
+internal var isSignalGraphEnabled: Bool {
+	return signalGraphSwitch.load() != 0
+}
+
+/// The view of a `Signal` core by the graph registry.
+internal protocol SignalGraphInspectable: AnyObject {
+	/// The status of the signal, and the number of its observers.
+	var graphState: (status: SignalGraphNode.Status, observerCount: Int) { get }
+}
+
+/// `SignalGraph` is a debug registry of the live `Signal`s, and the operators
+/// connecting them.
+///
+/// When enabled, every `Signal` created is registered, and every `Signal` operator
+/// records an edge from its upstream to the resulting `Signal`. The registry holds
+/// the signals weakly, so it does not extend their lifetime. The graph can be
+/// exported in the DOT format for Graphviz, or as JSON.
+///
+/// ```
+/// SignalGraph.start()
+/// // Run the workload.
+/// print(SignalGraph.snapshot().dot())
+/// ```
+///
+/// - note: `SignalProducer` operators compose event transformations without
+///         intermediate `Signal`s, so a started producer chain is seen as the
+///         `Signal` it produces.
+public enum SignalGraph {
+	private static let lock = Lock.make()
+	private static var entries: [ObjectIdentifier: SignalGraphEntry] = [:]
+	private static var edges: [SignalGraphEdge] = []
+	private static var nextID: UInt64 = 0
+
+	/// The number of entries beyond which the entries of deinitialized signals are
+	/// pruned on registration. It grows with the live entries, so that pruning is
+	/// amortized.
+	private static var pruneThreshold = 1024
+
+	/// Whether signals are being registered.
+	public static var isEnabled: Bool {
+		return isSignalGraphEnabled
+	}
+
+	/// Start registering signals created from now on.
+	public static func start() {
+		lock.lock()
+		signalGraphSwitch.store(1)
+		lock.unlock()
+	}
+
+	/// Stop registering signals, and clear the registry. Identities are reused after
+	/// the registry is cleared.
+	public static func stop() {
+		lock.lock()
+		signalGraphSwitch.store(0)
+		entries.removeAll()
+		edges.removeAll()
+		nextID = 0
+		pruneThreshold = 1024
+		lock.unlock()
+	}
+
+	/// Take a snapshot of the live signals, and the operators connecting them.
+	///
+	/// - returns: The snapshot.
+	public static func snapshot() -> SignalGraphSnapshot {
+		lock.lock()
+		prune()
+		let live = entries.values.compactMap { entry in entry.core.map { (entry, $0) } }
+		let liveEdges = edges
+		lock.unlock()
+
+		// Inspect the signals without the registry lock acquired, since it is
+		// acquired by signals as they are created.
+		let now = DispatchTime.now().uptimeNanoseconds
+		let nodes = live
+			.map { entry, core -> SignalGraphNode in
+				let state = core.graphState
+				return SignalGraphNode(
+					id: entry.id,
+					label: entry.label,
+					status: state.status,
+					observerCount: state.observerCount,
+					age: TimeInterval(now &- entry.createdAt) / 1_000_000_000
+				)
+			}
+			.sorted { $0.id < $1.id }
+
+		return SignalGraphSnapshot(nodes: nodes, edges: liveEdges)
+	}
+
+	/// Register a signal.
+	///
+	/// - parameters:
+	///   - core: The signal core.
+	///   - label: The label of the signal.
+	internal static func register(_ core: SignalGraphInspectable, label: @autoclosure () -> String) {
+		let label = label()
+
+		lock.lock()
+		defer { lock.unlock() }
+
+		// The registry may have been stopped since the caller checked the switch.
+		guard isSignalGraphEnabled else { return }
+
+		_ = entry(for: core, label: { label })
+
+		if entries.count > pruneThreshold {
+			prune()
+			pruneThreshold = max(1024, entries.count * 2)
+		}
+	}
+
+	/// Record an operator edge between two signals.
+	///
+	/// - parameters:
+	///   - upstream: The core of the signal to which the operator is applied.
+	///   - upstreamLabel: The label of the upstream signal.
+	///   - downstream: The core of the resulting signal.
+	///   - downstreamLabel: The label of the resulting signal.
+	///   - operator: The name of the operator.
+	internal static func link(
+		from upstream: SignalGraphInspectable,
+		_ upstreamLabel: @autoclosure () -> String,
+		to downstream: SignalGraphInspectable,
+		_ downstreamLabel: @autoclosure () -> String,
+		operator name: String
+	) {
+		lock.lock()
+		defer { lock.unlock() }
+
+		// The registry may have been stopped since the caller checked the switch.
+		guard isSignalGraphEnabled else { return }
+
+		// Either signal may have been created before the registry is enabled.
+		let from = entry(for: upstream, label: upstreamLabel)
+		let to = entry(for: downstream, label: downstreamLabel)
+		edges.append(SignalGraphEdge(from: from.id, to: to.id, operator: name))
+	}
+
+	/// Retrieve the entry of a signal core, creating it if necessary. The registry
+	/// lock must have been acquired.
+	private static func entry(for core: SignalGraphInspectable, label: () -> String) -> SignalGraphEntry {
+		let identifier = ObjectIdentifier(core)
+
+		// The identifier of a deinitialized core can be reused by a new core.
+		if let entry = entries[identifier], entry.core === core {
+			return entry
+		}
+
+		nextID += 1
+		let entry = SignalGraphEntry(id: nextID, core: core, label: label())
+		entries[identifier] = entry
+		return entry
+	}
+
+	/// Remove the entries of deinitialized signals, and their edges. The registry
+	/// lock must have been acquired.
+	private static func prune() {
+		entries = entries.filter { $0.value.core != nil }
+
+		let live = Set(entries.values.map { $0.id })
+		edges.removeAll { !live.contains($0.from) || !live.contains($0.to) }
+	}
+}
+
+private final class SignalGraphEntry {
+	let id: UInt64
+	let label: String
+	let createdAt: UInt64
+	weak var core: SignalGraphInspectable?
+
+	init(id: UInt64, core: SignalGraphInspectable, label: String) {
+		self.id = id
+		self.core = core
+		self.label = label
+		self.createdAt = DispatchTime.now().uptimeNanoseconds
+	}
+}
+
+/// A snapshot of the live signals registered by `SignalGraph`.
+public struct SignalGraphSnapshot: Encodable {
+	/// The live signals, ordered by their registration.
+	public let nodes: [SignalGraphNode]
+
+	/// The operators connecting the live signals, ordered by their application.
+	public let edges: [SignalGraphEdge]
+
+	/// Export the graph in the DOT format.
+	///
+	/// - returns: The graph as a DOT `digraph`.
+	public func dot() -> String {
+		func escaped(_ string: String) -> String {
+			return string
+				.replacingOccurrences(of: "\\", with: "\\\\")
+				.replacingOccurrences(of: "\"", with: "\\\"")
+		}
+
+		var lines = ["digraph signals {", "\tnode [shape=box];"]
+
+		for node in nodes {
+			let label = "\(escaped(node.label))\\n\(node.status.rawValue), \(node.observerCount) observer(s)"
+			lines.append("\tn\(node.id) [label=\"\(label)\"];")
+		}
+
+		for edge in edges {
+			lines.append("\tn\(edge.from) -> n\(edge.to) [label=\"\(escaped(edge.operator))\"];")
+		}
+
+		lines.append("}")
+		return lines.joined(separator: "\n") + "\n"
+	}
+
+	/// Export the graph as JSON.
+	///
+	/// - returns: The graph as a JSON object with `nodes` and `edges`.
+	public func json() -> Data {
+		return try! JSONEncoder().encode(self)
+	}
+}
+
+/// A live signal.
+public struct SignalGraphNode: Encodable {
+	/// The status of a signal.
+	public enum Status: String, Encodable {
+		/// The signal is retained, and has not terminated.
+		case alive
+
+		/// The signal is no longer retained, but is kept alive by its observers.
+		case unretained
+
+		/// The signal is delivering its terminal event.
+		case terminating
+
+		/// The signal has terminated.
+		case terminated
+	}
+
+	/// The identity of the signal in the registry.
+	public let id: UInt64
+
+	/// The type of the signal.
+	public let label: String
+
+	/// The status of the signal.
+	public let status: Status
+
+	/// The number of observers of the signal.
+	public let observerCount: Int
+
+	/// The time since the signal was registered, in seconds.
+	public let age: TimeInterval
+}
+
+/// An operator connecting two signals.
+public struct SignalGraphEdge: Encodable {
+	/// The identity of the signal to which the operator is applied.
+	public let from: UInt64
+
+	/// The identity of the signal resulting from the operator.
+	public let to: UInt64
+
+	/// The name of the operator.
+	public let `operator`: String
+}
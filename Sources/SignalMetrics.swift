@@ -0,0 +1,461 @@
+import Dispatch
+import Foundation
+#if os(iOS) || os(macOS) || os(tvOS) || os(watchOS)
+import Darwin.POSIX.pthread
+#else
+import Glibc
+#endif
+
+/// The switch of `SignalMetrics`, which is nonzero while operators record metrics.
+private let signalMetricsSwitch = AtomicInt32(0)
+
+/// Whether operators record metrics. Reading it costs a single atomic load, so
+/// that disabled metrics cost a load and branch.
+internal var isSignalMetricsEnabled: Bool {
+	return signalMetricsSwitch.load() != 0
+}
+
+/// `SignalMetrics` records per-operator event counts and callback durations, and the
+/// number of values buffered by buffering operators.
+///
+/// When enabled, every stage created by a `Signal` or `SignalProducer` operator counts
+/// the events it receives, and measures the time spent in its callback, including the
+/// time spent by the downstream stages. Stages are identified by their operator, e.g.
+/// `SignalProducer.map(_:)`, and the metrics of all instances of an operator are
+/// aggregated. Value delivery by every `Signal` to its observers is recorded as the
+/// `Signal.send` stage.
+///
+/// `observe(on:)`, `zip`, `flatten` with a concurrent strategy, and `replayLazily`
+/// additionally report the values they are holding as gauges.
+///
+/// Metrics are recorded in counters owned by the recording thread, and merged when a
+/// snapshot is taken. Only the stages of `Signal`s created, and of `SignalProducer`s
+/// both composed and started, while metrics are enabled are instrumented.
+public enum SignalMetrics {
+	private static let lock = Lock.make()
+	private static var stageIndices: [String: Int] = ["Signal.send": 0]
+	private static var stageNames: [String] = ["Signal.send"]
+	private static var gaugeIndices: [String: Int] = [:]
+	private static var gaugeNames: [String] = []
+	private static var threads: [SignalMetricsCounters] = []
+
+	/// The counters of the threads which have exited.
+	private static let retired = SignalMetricsCounters()
+
+	internal static let delivery = SignalMetricsStage(index: 0)
+
+	/// Whether metrics are being recorded.
+	public static var isEnabled: Bool {
+		return isSignalMetricsEnabled
+	}
+
+	/// Start recording metrics.
+	public static func start() {
+		signalMetricsSwitch.store(1)
+	}
+
+	/// Stop recording metrics. The metrics recorded so far are kept until they are
+	/// reset.
+	public static func stop() {
+		signalMetricsSwitch.store(0)
+	}
+
+	/// Reset the event counts and the callback durations of all stages. Gauges are
+	/// kept, since they reflect the values being held.
+	public static func reset() {
+		lock.lock()
+		defer { lock.unlock() }
+
+		for counters in threads + [retired] {
+			counters.lock.lock()
+			counters.stages.removeAll()
+			counters.lock.unlock()
+		}
+	}
+
+	/// Take a snapshot of the metrics, merging the counters of all threads.
+	///
+	/// - returns: The snapshot.
+	public static func snapshot() -> SignalMetricsSnapshot {
+		lock.lock()
+		defer { lock.unlock() }
+
+		let merged = SignalMetricsCounters()
+		for counters in threads + [retired] {
+			counters.lock.lock()
+			merged.merge(counters)
+			counters.lock.unlock()
+		}
+
+		var stages: [String: SignalStageMetrics] = [:]
+		for (index, counters) in merged.stages.enumerated() where counters.events > 0 {
+			stages[stageNames[index]] = SignalStageMetrics(counters)
+		}
+
+		var gauges: [String: Int] = [:]
+		for (index, name) in gaugeNames.enumerated() {
+			gauges[name] = index < merged.gauges.count ? merged.gauges[index] : 0
+		}
+
+		return SignalMetricsSnapshot(stages: stages, gauges: gauges)
+	}
+
+	/// Create a producer which sends a snapshot of the metrics periodically.
+	///
+	/// - parameters:
+	///   - interval: The interval between snapshots.
+	///   - scheduler: The scheduler on which snapshots are taken and sent.
+	///
+	/// - returns: A producer which sends a snapshot every `interval`.
+	public static func snapshots(every interval: DispatchTimeInterval, on scheduler: DateScheduler) -> SignalProducer<SignalMetricsSnapshot, Never> {
+		return SignalProducer.timer(interval: interval, on: scheduler)
+			.map { _ in SignalMetrics.snapshot() }
+	}
+
+	/// Instrument the stages created by an event transformation.
+	///
+	/// - parameters:
+	///   - transform: The event transformation.
+	///   - type: The type declaring the operator.
+	///   - name: The name of the operator.
+	///
+	/// - returns: `transform` if metrics are disabled. Otherwise, an event
+	///            transformation which records the metrics of the stage it creates,
+	///            if metrics are still enabled at the time.
+	internal static func instrument<Value, Error: Swift.Error, U, E: Swift.Error>(
+		_ transform: @escaping Signal<Value, Error>.Event.Transformation<U, E>,
+		type: StaticString,
+		name: StaticString
+	) -> Signal<Value, Error>.Event.Transformation<U, E> {
+		guard isSignalMetricsEnabled else { return transform }
+
+		let stage = self.stage(named: "\(type).\(name)")
+
+		return { output, lifetime in
+			let input = transform(output, lifetime)
+
+			guard isSignalMetricsEnabled else { return input }
+			return Operators.Instrumented(downstream: input, stage: stage)
+		}
+	}
+
+	/// Retrieve the stage of the given name, registering it if necessary.
+	internal static func stage(named name: String) -> SignalMetricsStage {
+		lock.lock()
+		defer { lock.unlock() }
+
+		if let index = stageIndices[name] {
+			return SignalMetricsStage(index: index)
+		}
+
+		stageNames.append(name)
+		stageIndices[name] = stageNames.count - 1
+		return SignalMetricsStage(index: stageNames.count - 1)
+	}
+
+	/// Retrieve the gauge of the given name, registering it if necessary.
+	///
+	/// - returns: The gauge, or `nil` if metrics are disabled.
+	internal static func gauge(named name: StaticString) -> SignalMetricsGauge? {
+		guard isSignalMetricsEnabled else { return nil }
+
+		let name = "\(name)"
+
+		lock.lock()
+		defer { lock.unlock() }
+
+		if let index = gaugeIndices[name] {
+			return SignalMetricsGauge(index: index)
+		}
+
+		gaugeNames.append(name)
+		gaugeIndices[name] = gaugeNames.count - 1
+		return SignalMetricsGauge(index: gaugeNames.count - 1)
+	}
+
+	/// The current time for measuring callback durations.
+	internal static func now() -> UInt64 {
+		return DispatchTime.now().uptimeNanoseconds
+	}
+
+	private static let key: pthread_key_t = {
+		var key = pthread_key_t()
+		let status = pthread_key_create(&key) { pointer in
+			#if os(Linux)
+			guard let pointer = pointer else { return }
+			#endif
+			let counters = Unmanaged<SignalMetricsCounters>.fromOpaque(pointer).takeRetainedValue()
+			SignalMetrics.retire(counters)
+		}
+		precondition(status == 0, "Unexpected pthread key error code: \(status)")
+		return key
+	}()
+
+	/// The counters of the current thread, created on demand.
+	fileprivate static func currentCounters() -> SignalMetricsCounters {
+		if let pointer = pthread_getspecific(key) {
+			return Unmanaged<SignalMetricsCounters>.fromOpaque(pointer).takeUnretainedValue()
+		}
+
+		let counters = SignalMetricsCounters()
+		lock.lock()
+		threads.append(counters)
+		lock.unlock()
+
+		pthread_setspecific(key, Unmanaged.passRetained(counters).toOpaque())
+		return counters
+	}
+
+	/// Fold the counters of an exiting thread into the retired counters.
+	private static func retire(_ counters: SignalMetricsCounters) {
+		lock.lock()
+		defer { lock.unlock() }
+
+		threads.removeAll { $0 === counters }
+
+		counters.lock.lock()
+		retired.lock.lock()
+		retired.merge(counters)
+		retired.lock.unlock()
+		counters.lock.unlock()
+	}
+}
+
+/// A stage of which the event counts and the callback durations are recorded.
+internal struct SignalMetricsStage {
+	let index: Int
+
+	/// Record an event received by the stage.
+	///
+	/// - parameters:
+	///   - event: The kind of the event.
+	///   - start: The time at which the callback of the stage started.
+	func record(_ event: SignalMetricsEvent, since start: UInt64) {
+		let duration = SignalMetrics.now() &- start
+		let counters = SignalMetrics.currentCounters()
+
+		counters.lock.lock()
+		if counters.stages.count <= index {
+			counters.stages.append(contentsOf: repeatElement(SignalMetricsStageCounters(), count: index + 1 - counters.stages.count))
+		}
+		counters.stages[index].record(event, duration: duration)
+		counters.lock.unlock()
+	}
+}
+
+/// A gauge of the values held by buffering operators.
+internal struct SignalMetricsGauge {
+	let index: Int
+
+	/// Adjust the level of the gauge.
+	///
+	/// - parameters:
+	///   - delta: The change in the number of values held.
+	func add(_ delta: Int) {
+		guard delta != 0 else { return }
+
+		let counters = SignalMetrics.currentCounters()
+
+		counters.lock.lock()
+		if counters.gauges.count <= index {
+			counters.gauges.append(contentsOf: repeatElement(0, count: index + 1 - counters.gauges.count))
+		}
+		counters.gauges[index] += delta
+		counters.lock.unlock()
+	}
+}
+
+internal enum SignalMetricsEvent {
+	case value
+	case failed
+	case completed
+	case interrupted
+
+	init<Error>(_ termination: Termination<Error>) {
+		switch termination {
+		case .failed:
+			self = .failed
+		case .completed:
+			self = .completed
+		case .interrupted:
+			self = .interrupted
+		}
+	}
+}
+
+/// The counters of a thread. The lock is acquired by the owning thread when it
+/// records, and is contended only when a snapshot is being taken.
+private final class SignalMetricsCounters {
+	let lock = Lock.make()
+	var stages: ContiguousArray<SignalMetricsStageCounters> = []
+
+	/// The changes in the level of the gauges made by the thread.
+	var gauges: ContiguousArray<Int> = []
+
+	func merge(_ other: SignalMetricsCounters) {
+		if stages.count < other.stages.count {
+			stages.append(contentsOf: repeatElement(SignalMetricsStageCounters(), count: other.stages.count - stages.count))
+		}
+		for index in other.stages.indices {
+			stages[index].merge(other.stages[index])
+		}
+
+		if gauges.count < other.gauges.count {
+			gauges.append(contentsOf: repeatElement(0, count: other.gauges.count - gauges.count))
+		}
+		for index in other.gauges.indices {
+			gauges[index] += other.gauges[index]
+		}
+	}
+}
+
+private struct SignalMetricsStageCounters {
+	var values: UInt64 = 0
+	var failures: UInt64 = 0
+	var completions: UInt64 = 0
+	var interruptions: UInt64 = 0
+	var totalNanoseconds: UInt64 = 0
+	var buckets: [UInt64] = []
+
+	var events: UInt64 {
+		return values + failures + completions + interruptions
+	}
+
+	mutating func record(_ event: SignalMetricsEvent, duration: UInt64) {
+		switch event {
+		case .value:
+			values += 1
+		case .failed:
+			failures += 1
+		case .completed:
+			completions += 1
+		case .interrupted:
+			interruptions += 1
+		}
+
+		if buckets.isEmpty {
+			buckets = Array(repeating: 0, count: SignalMetricsHistogram.bucketCount)
+		}
+
+		totalNanoseconds &+= duration
+		buckets[SignalMetricsHistogram.bucket(for: duration)] += 1
+	}
+
+	mutating func merge(_ other: SignalMetricsStageCounters) {
+		values += other.values
+		failures += other.failures
+		completions += other.completions
+		interruptions += other.interruptions
+		totalNanoseconds &+= other.totalNanoseconds
+
+		guard !other.buckets.isEmpty else { return }
+
+		if buckets.isEmpty {
+			buckets = other.buckets
+		} else {
+			for index in buckets.indices {
+				buckets[index] += other.buckets[index]
+			}
+		}
+	}
+}
+
+/// A snapshot of the metrics recorded by `SignalMetrics`.
+public struct SignalMetricsSnapshot {
+	/// The metrics of every stage which has received at least one event, keyed by
+	/// the operator.
+	public let stages: [String: SignalStageMetrics]
+
+	/// The number of values held by buffering operators, keyed by the operator.
+	public let gauges: [String: Int]
+}
+
+/// The metrics of the stages created by an operator.
+public struct SignalStageMetrics {
+	/// The number of values received.
+	public let values: UInt64
+
+	/// The number of `failed` events received.
+	public let failures: UInt64
+
+	/// The number of `completed` events received.
+	public let completions: UInt64
+
+	/// The number of `interrupted` events received.
+	public let interruptions: UInt64
+
+	/// The distribution of the time spent in the callback of the stage for every
+	/// event, including the downstream stages.
+	public let callbackDuration: SignalMetricsHistogram
+
+	/// The number of events received.
+	public var events: UInt64 {
+		return values + failures + completions + interruptions
+	}
+
+	fileprivate init(_ counters: SignalMetricsStageCounters) {
+		values = counters.values
+		failures = counters.failures
+		completions = counters.completions
+		interruptions = counters.interruptions
+		callbackDuration = SignalMetricsHistogram(
+			totalNanoseconds: counters.totalNanoseconds,
+			buckets: counters.buckets.isEmpty ? Array(repeating: 0, count: SignalMetricsHistogram.bucketCount) : counters.buckets
+		)
+	}
+}
+
+/// A histogram of durations with logarithmic buckets.
+///
+/// The bucket at index `0` counts the durations of zero nanoseconds, and the bucket
+/// at index `i` counts the durations within `2^(i-1) ..< 2^i` nanoseconds.
+public struct SignalMetricsHistogram {
+	fileprivate static let bucketCount = 65
+
+	/// The sum of the durations, in nanoseconds.
+	public let totalNanoseconds: UInt64
+
+	/// The number of durations in each bucket.
+	public let buckets: [UInt64]
+
+	/// The number of durations.
+	public var count: UInt64 {
+		return buckets.reduce(0, +)
+	}
+
+	/// The mean duration in nanoseconds, or `nil` if the histogram is empty.
+	public var meanNanoseconds: Double? {
+		let count = self.count
+		return count > 0 ? Double(totalNanoseconds) / Double(count) : nil
+	}
+
+	/// Estimate a percentile of the durations.
+	///
+	/// - parameters:
+	///   - percentile: The percentile, within `0 ... 100`.
+	///
+	/// - returns: The upper bound of the bucket containing the percentile in
+	///            nanoseconds, or `nil` if the histogram is empty.
+	public func percentile(_ percentile: Double) -> UInt64? {
+		precondition((0 ... 100).contains(percentile), "Invalid percentile: \(percentile)")
+
+		let count = self.count
+		guard count > 0 else { return nil }
+
+		let rank = max(1, UInt64((percentile / 100 * Double(count)).rounded(.up)))
+		var accumulated: UInt64 = 0
+
+		for (index, bucket) in buckets.enumerated() {
+			accumulated += bucket
+			if accumulated >= rank {
+				return index == 0 ? 0 : (index == 64 ? .max : (1 << UInt64(index)) - 1)
+			}
+		}
+
+		return .max
+	}
+
+	fileprivate static func bucket(for duration: UInt64) -> Int {
+		return UInt64.bitWidth - duration.leadingZeroBitCount
+	}
+}
@@ -182,6 +182,139 @@ public struct SignalProducer<Value, Error: Swift.Error> {
 		})
 	}
 
+	/// Creates a producer for a Signal that will send the values from the given
+	/// sequence in batches of `batchSize`, then complete.
+	///
+	/// Unlike `init(_:)`, the producer checks whether it has been interrupted only
+	/// between batches, so up to `batchSize - 1` values may be taken from `values`
+	/// after the producer has been interrupted.
+	///
+	/// If `scheduler` is given, every batch is sent in a separate action on it, so that
+	/// a large sequence does not monopolize the thread of the scheduler.
+	///
+	/// - precondition: `batchSize` must be positive.
+	///
+	/// - parameters:
+	///   - values: A sequence of values that a `Signal` will send as separate
+	///             `value` events and then complete.
+	///   - batchSize: The number of values sent between interruption checks.
+	///   - scheduler: A scheduler to send every batch on, if any.
+	public init<S: Sequence>(_ values: S, batchSize: Int, on scheduler: Scheduler? = nil) where S.Element == Value {
+		precondition(batchSize > 0)
+
+		self.init(SignalProducer.makeBatchCore(values, on: scheduler) { iterator, observer in
+			for _ in 0 ..< batchSize {
+				guard let value = iterator.next() else { return false }
+				observer.send(value: value)
+			}
+			return true
+		})
+	}
+
+	/// Creates a producer for a Signal that will send the values from the given
+	/// sequence in contiguous chunks of `size`, then complete. The last chunk holds
+	/// the remaining values, and may be smaller.
+	///
+	/// The producer checks whether it has been interrupted only between chunks.
+	///
+	/// If `scheduler` is given, every chunk is sent in a separate action on it, so that
+	/// a large sequence does not monopolize the thread of the scheduler.
+	///
+	/// - precondition: `size` must be positive.
+	///
+	/// - parameters:
+	///   - values: A sequence of values that a `Signal` will send in chunks.
+	///   - size: The number of values in every chunk.
+	///   - scheduler: A scheduler to send every chunk on, if any.
+	public init<S: Sequence>(chunksOf values: S, size: Int, on scheduler: Scheduler? = nil) where Value == [S.Element] {
+		precondition(size > 0)
+
+		self.init(SignalProducer.makeBatchCore(values, on: scheduler) { iterator, observer in
+			var chunk: [S.Element] = []
+			chunk.reserveCapacity(size)
+
+			while chunk.count < size, let value = iterator.next() {
+				chunk.append(value)
+			}
+
+			if !chunk.isEmpty {
+				observer.send(value: chunk)
+			}
+			return chunk.count == size
+		})
+	}
+
+	/// Make the core of a producer sending batches taken from a sequence.
+	///
+	/// - parameters:
+	///   - values: The sequence.
+	///   - scheduler: A scheduler to send every batch on, if any.
+	///   - sendBatch: A closure sending a batch taken from the iterator to the
+	///                observer, which returns `false` if the iterator has been
+	///                exhausted.
+	///
+	/// - returns: The core of the producer.
+	private static func makeBatchCore<S: Sequence>(
+		_ values: S,
+		on scheduler: Scheduler?,
+		sendBatch: @escaping (inout S.Iterator, Signal<Value, Error>.Observer) -> Bool
+	) -> SignalProducerCore<Value, Error> {
+		guard let scheduler = scheduler else {
+			return GeneratorCore(isDisposable: true) { observer, disposable in
+				var iterator = values.makeIterator()
+
+				while !disposable.isDisposed {
+					if !sendBatch(&iterator, observer) {
+						observer.sendCompleted()
+						return
+					}
+				}
+			}
+		}
+
+		return SignalProducer { observer, lifetime in
+			let scheduledDisposable = SerialDisposable()
+			lifetime += scheduledDisposable
+
+			var iterator = values.makeIterator()
+
+			// If the scheduler runs an action synchronously, e.g. `ImmediateScheduler`,
+			// the next batch is scheduled by the loop which has scheduled the action,
+			// so that the stack does not grow with every batch.
+			func scheduleBatches() {
+				var shouldContinue = true
+
+				while shouldContinue {
+					shouldContinue = false
+
+					let state = UnsafeAtomicState<StartingState>(.starting)
+					let deinitializer = ScopedDisposable(AnyDisposable(state.deinitialize))
+
+					scheduledDisposable.inner = scheduler.schedule {
+						guard !lifetime.hasEnded else { return }
+
+						guard sendBatch(&iterator, observer) else {
+							observer.sendCompleted()
+							return
+						}
+
+						withExtendedLifetime(deinitializer) {
+							if !state.tryTransition(from: .starting, to: .completed) {
+								scheduleBatches()
+							}
+						}
+					}
+
+					withExtendedLifetime(deinitializer) {
+						shouldContinue = !state.tryTransition(from: .starting, to: .started)
+					}
+				}
+			}
+
+			scheduleBatches()
+		}.core
+	}
+
 	/// Creates a producer for a Signal that will immediately send the values
 	/// from the given sequence, then complete.
 	///
@@ -276,9 +409,12 @@ internal class SignalProducerCore<Value, Error: Swift.Error> {
 	/// - parameters:
 	///   - transform: A closure that creates the said action from the given event
 	///                closure.
+	///   - name: The name of the operator, which identifies the stage in
+	///           `SignalMetrics`.
 	///
 	/// - returns: A producer that forwards events yielded by the action.
-	internal func flatMapEvent<U, E>(_ transform: @escaping Signal<Value, Error>.Event.Transformation<U, E>) -> SignalProducer<U, E> {
+	internal func flatMapEvent<U, E>(_ transform: @escaping Signal<Value, Error>.Event.Transformation<U, E>, name: StaticString = #function) -> SignalProducer<U, E> {
+		let transform = SignalMetrics.instrument(transform, type: "SignalProducer", name: name)
 		return SignalProducer<U, E>(TransformerCore(source: self, transform: transform))
 	}
 }
@@ -376,7 +512,8 @@ private final class TransformerCore<Value, Error: Swift.Error, SourceValue, Sour
 		return disposables
 	}
 
-	internal override func flatMapEvent<U, E>(_ transform: @escaping Signal<Value, Error>.Event.Transformation<U, E>) -> SignalProducer<U, E> {
+	internal override func flatMapEvent<U, E>(_ transform: @escaping Signal<Value, Error>.Event.Transformation<U, E>, name: StaticString = #function) -> SignalProducer<U, E> {
+		let transform = SignalMetrics.instrument(transform, type: "SignalProducer", name: name)
 		return SignalProducer<U, E>(TransformerCore<U, E, SourceValue, SourceError>(source: source) { [innerTransform = self.transform] action, lifetime in
 			return innerTransform(transform(action, lifetime), lifetime)
 		})
@@ -634,6 +771,12 @@ extension SignalProducer {
 			setup(signal)
 		}
 	}
+
+	/// Perform an action upon every event from the produced `Signal`, for operators
+	/// declared outside of this file. See `SignalProducerCore.flatMapEvent(_:name:)`.
+	internal func flatMapEvent<U, E>(_ transform: @escaping Signal<Value, Error>.Event.Transformation<U, E>, name: StaticString = #function) -> SignalProducer<U, E> {
+		return core.flatMapEvent(transform, name: name)
+	}
 }
 
 extension SignalProducer where Error == Never {
@@ -2280,26 +2423,46 @@ extension SignalProducer {
 			let serialDisposable = SerialDisposable()
 			lifetime += serialDisposable
 
-			func iterate(_ current: Int) {
-				self.startWithSignal { signal, signalDisposable in
-					serialDisposable.inner = signalDisposable
-
-					signal.observe { event in
-						if case .completed = event {
-							let remainingTimes = current - 1
-							if remainingTimes > 0 {
-								iterate(remainingTimes)
-							} else {
-								observer.sendCompleted()
+			var remainingTimes = count
+
+			// Start the repetitions in a loop as long as they complete synchronously, so
+			// that the stack does not grow with the number of repetitions. A repetition
+			// completing asynchronously resumes the loop on its own stack.
+			func iterate() {
+				var shouldContinue = true
+
+				while shouldContinue {
+					let state = UnsafeAtomicState<StartingState>(.starting)
+					let deinitializer = ScopedDisposable(AnyDisposable(state.deinitialize))
+
+					self.startWithSignal { signal, signalDisposable in
+						serialDisposable.inner = signalDisposable
+
+						signal.observe { event in
+							guard case .completed = event else {
+								observer.send(event)
+								return
+							}
+
+							remainingTimes -= 1
+
+							withExtendedLifetime(deinitializer) {
+								if remainingTimes == 0 {
+									observer.sendCompleted()
+								} else if !state.tryTransition(from: .starting, to: .completed) {
+									iterate()
+								}
 							}
-						} else {
-							observer.send(event)
 						}
 					}
+
+					withExtendedLifetime(deinitializer) {
+						shouldContinue = !state.tryTransition(from: .starting, to: .started)
+					}
 				}
 			}
 
-			iterate(count)
+			iterate()
 		}
 	}
 
@@ -2316,11 +2479,9 @@ extension SignalProducer {
 
 		if count == 0 {
 			return producer
-		} else {
-			return flatMapError { _ in
-				self.retry(upTo: count - 1)
-			}
 		}
+
+		return _retry(upTo: count, backoff: nil, budget: nil, on: nil, when: { _ in true })
 	}
 
 	/// Delays retrying on failure by `interval` up to `count` attempts.
@@ -2334,27 +2495,109 @@ extension SignalProducer {
 	///
 	/// - returns: A signal producer that restarts up to `count` times.
 	public func retry(upTo count: Int, interval: TimeInterval, on scheduler: DateScheduler) -> SignalProducer<Value, Error> {
+		return retry(upTo: count, backoff: .constant(interval), on: scheduler)
+	}
+
+	/// Retry on failure up to `count` times, delaying every retry as determined by
+	/// `backoff`.
+	///
+	/// The failures which are not retried, either because `shouldRetry` rejects them,
+	/// `count` retries have been made, or `budget` is exhausted, are forwarded without
+	/// a delay.
+	///
+	/// ```
+	/// request
+	///     .retry(
+	///         upTo: 5,
+	///         backoff: .exponential(initial: 0.1, maximum: 10, jitter: 0.5),
+	///         on: QueueScheduler(),
+	///         when: { $0.isTransient }
+	///     )
+	/// ```
+	///
+	/// - note: The retries are made by restarting `self`, without constructing a
+	///         producer per retry.
+	///
+	/// - precondition: `count` must be non-negative integer.
+	///
+	/// - parameters:
+	///   - count: The maximum number of retries.
+	///   - backoff: The backoff determining the delay before every retry.
+	///   - budget: A budget of retries which is shared with other producers, if any.
+	///   - scheduler: A scheduler to restart `self` on.
+	///   - shouldRetry: A closure to determine whether a failure should be retried.
+	///
+	/// - returns: A signal producer that restarts up to `count` times.
+	public func retry(
+		upTo count: Int,
+		backoff: RetryBackoff,
+		budget: RetryBudget? = nil,
+		on scheduler: DateScheduler,
+		when shouldRetry: @escaping (Error) -> Bool = { _ in true }
+	) -> SignalProducer<Value, Error> {
 		precondition(count >= 0)
 
 		if count == 0 {
 			return producer
 		}
 
-		var retries = count
+		return _retry(upTo: count, backoff: backoff, budget: budget, on: scheduler, when: shouldRetry)
+	}
+
+	private func _retry(
+		upTo count: Int,
+		backoff: RetryBackoff?,
+		budget: RetryBudget?,
+		on scheduler: DateScheduler?,
+		when shouldRetry: @escaping (Error) -> Bool
+	) -> SignalProducer<Value, Error> {
+		return SignalProducer { observer, lifetime in
+			let serialDisposable = SerialDisposable()
+			lifetime += serialDisposable
 
-		return flatMapError { error -> SignalProducer<Value, Error> in
-				// The final attempt shouldn't defer the error if it fails
-				var producer = SignalProducer<Value, Error>(error: error)
-				if retries > 0 {
-					producer = SignalProducer.empty
-						.delay(interval, on: scheduler)
-						.concat(producer)
-				}
+			var retries = 0
+
+			budget?.deposit()
 
-				retries -= 1
-				return producer
+			// Restart `self` in a loop as long as it fails synchronously and the retry
+			// is not delayed, so that the stack does not grow with the number of retries.
+			func attempt() {
+				var shouldContinue = true
+
+				while shouldContinue {
+					let state = UnsafeAtomicState<StartingState>(.starting)
+					let deinitializer = ScopedDisposable(AnyDisposable(state.deinitialize))
+
+					self.startWithSignal { signal, signalDisposable in
+						serialDisposable.inner = signalDisposable
+
+						signal.observe { event in
+							guard case let .failed(error) = event, retries < count, shouldRetry(error), budget?.withdraw() ?? true else {
+								observer.send(event)
+								return
+							}
+
+							retries += 1
+
+							withExtendedLifetime(deinitializer) {
+								if let backoff = backoff, let scheduler = scheduler {
+									let date = scheduler.currentDate.addingTimeInterval(backoff.delay(beforeRetry: retries))
+									serialDisposable.inner = scheduler.schedule(after: date, action: attempt)
+								} else if !state.tryTransition(from: .starting, to: .completed) {
+									attempt()
+								}
+							}
+						}
+					}
+
+					withExtendedLifetime(deinitializer) {
+						shouldContinue = !state.tryTransition(from: .starting, to: .started)
+					}
+				}
 			}
-			.retry(upTo: count)
+
+			attempt()
+		}
 	}
 
 	/// Wait for completion of `self`, *then* forward all events from
@@ -2462,6 +2705,9 @@ extension SignalProducer {
 
 	internal func _then<Replacement: SignalProducerConvertible>(_ replacement: Replacement) -> SignalProducer<Replacement.Value, Error> where Replacement.Error == Error {
 		return SignalProducer<Replacement.Value, Error> { observer, lifetime in
+			let state = UnsafeAtomicState<StartingState>(.starting)
+			let deinitializer = ScopedDisposable(AnyDisposable(state.deinitialize))
+
 			self.startWithSignal { signal, signalDisposable in
 				lifetime += signalDisposable
 
@@ -2470,7 +2716,13 @@ extension SignalProducer {
 					case let .failed(error):
 						observer.send(error: error)
 					case .completed:
-						lifetime += replacement.producer.start(observer)
+						// If `self` completes synchronously, `replacement` is started after
+						// `self` has returned, so that chains of `then` do not nest.
+						withExtendedLifetime(deinitializer) {
+							if !state.tryTransition(from: .starting, to: .completed) {
+								lifetime += replacement.producer.start(observer)
+							}
+						}
 					case .interrupted:
 						observer.sendInterrupted()
 					case .value:
@@ -2478,6 +2730,12 @@ extension SignalProducer {
 					}
 				}
 			}
+
+			withExtendedLifetime(deinitializer) {
+				if !state.tryTransition(from: .starting, to: .started) {
+					lifetime += replacement.producer.start(observer)
+				}
+			}
 		}
 	}
 }
@@ -2578,10 +2836,12 @@ extension SignalProducer {
 	/// represent those cases. However, when no values are sent, `nil` will be
 	/// returned.
 	///
+	/// - note: Use `first(completion:)` to avoid blocking the calling thread.
+	///
 	/// - returns: Result when single `value` or `failed` event is received.
 	///            `nil` when no events are received.
 	public func first() -> Result<Value, Error>? {
-		return take(first: 1).single()
+		return blockUntilFinished(first(completion:))
 	}
 
 	/// Start the producer, then block, waiting for events: `value` and
@@ -2591,31 +2851,12 @@ extension SignalProducer {
 	/// represent those cases. However, when no values are sent, or when more
 	/// than one value is sent, `nil` will be returned.
 	///
+	/// - note: Use `single(completion:)` to avoid blocking the calling thread.
+	///
 	/// - returns: Result when single `value` or `failed` event is received.
 	///            `nil` when 0 or more than 1 events are received.
 	public func single() -> Result<Value, Error>? {
-		let semaphore = DispatchSemaphore(value: 0)
-		var result: Result<Value, Error>?
-
-		take(first: 2).start { event in
-			switch event {
-			case let .value(value):
-				if result != nil {
-					// Move into failure state after recieving another value.
-					result = nil
-					return
-				}
-				result = .success(value)
-			case let .failed(error):
-				result = .failure(error)
-				semaphore.signal()
-			case .completed, .interrupted:
-				semaphore.signal()
-			}
-		}
-
-		semaphore.wait()
-		return result
+		return blockUntilFinished(single(completion:))
 	}
 
 	/// Start the producer, then block, waiting for the last value.
@@ -2624,10 +2865,12 @@ extension SignalProducer {
 	/// represent those cases. However, when no values are sent, `nil` will be
 	/// returned.
 	///
+	/// - note: Use `last(completion:)` to avoid blocking the calling thread.
+	///
 	/// - returns: Result when single `value` or `failed` event is received.
 	///            `nil` when no events are received.
 	public func last() -> Result<Value, Error>? {
-		return take(last: 1).single()
+		return blockUntilFinished(last(completion:))
 	}
 
 	/// Starts the producer, then blocks, waiting for completion.
@@ -2635,10 +2878,180 @@ extension SignalProducer {
 	/// When a completion or error is sent, the returned `Result` will represent
 	/// those cases.
 	///
+	/// - note: Use `wait(completion:)` to avoid blocking the calling thread.
+	///
 	/// - returns: Result when single `completion` or `failed` event is
 	///            received.
 	public func wait() -> Result<(), Error> {
-		return then(SignalProducer<(), Error>(value: ())).last() ?? .success(())
+		return blockUntilFinished(wait(completion:))
+	}
+
+	/// Start the producer, and invoke `completion` with the first value, without
+	/// blocking the calling thread. The producer is interrupted as soon as the first
+	/// value is received.
+	///
+	/// Disposing of the returned disposable interrupts the producer, in which case
+	/// `completion` is invoked with `nil`, unless it has been invoked already.
+	///
+	/// - parameters:
+	///   - completion: A closure to be invoked once, with `Result` when a `value` or
+	///                 `failed` event is received, or `nil` when no values are
+	///                 received.
+	///
+	/// - returns: A disposable to interrupt the producer.
+	@discardableResult
+	public func first(completion: @escaping (Result<Value, Error>?) -> Void) -> Disposable {
+		return startWithOutcome(completion) { event, finish in
+			switch event {
+			case let .value(value):
+				finish(.success(value))
+			case let .failed(error):
+				finish(.failure(error))
+			case .completed, .interrupted:
+				finish(nil)
+			}
+		}
+	}
+
+	/// Start the producer, and invoke `completion` with the only value, without
+	/// blocking the calling thread. The producer is interrupted as soon as a second
+	/// value is received.
+	///
+	/// Disposing of the returned disposable interrupts the producer, in which case
+	/// `completion` is invoked with the value received so far, unless it has been
+	/// invoked already.
+	///
+	/// - parameters:
+	///   - completion: A closure to be invoked once, with `Result` when a single
+	///                 `value` or `failed` event is received, or `nil` when 0 or
+	///                 more than 1 values are received.
+	///
+	/// - returns: A disposable to interrupt the producer.
+	@discardableResult
+	public func single(completion: @escaping (Result<Value, Error>?) -> Void) -> Disposable {
+		var result: Result<Value, Error>?
+
+		return startWithOutcome(completion) { event, finish in
+			switch event {
+			case let .value(value):
+				if result == nil {
+					result = .success(value)
+				} else {
+					finish(nil)
+				}
+			case let .failed(error):
+				finish(.failure(error))
+			case .completed, .interrupted:
+				finish(result)
+			}
+		}
+	}
+
+	/// Start the producer, and invoke `completion` with the last value, without
+	/// blocking the calling thread.
+	///
+	/// Disposing of the returned disposable interrupts the producer, in which case
+	/// `completion` is invoked with the last value received so far, unless it has
+	/// been invoked already.
+	///
+	/// - parameters:
+	///   - completion: A closure to be invoked once, with `Result` when a `value` or
+	///                 `failed` event is received, or `nil` when no values are
+	///                 received.
+	///
+	/// - returns: A disposable to interrupt the producer.
+	@discardableResult
+	public func last(completion: @escaping (Result<Value, Error>?) -> Void) -> Disposable {
+		var lastValue: Value?
+
+		return startWithOutcome(completion) { event, finish in
+			switch event {
+			case let .value(value):
+				lastValue = value
+			case let .failed(error):
+				finish(.failure(error))
+			case .completed, .interrupted:
+				finish(lastValue.map { .success($0) })
+			}
+		}
+	}
+
+	/// Start the producer, and invoke `completion` when it terminates, without
+	/// blocking the calling thread.
+	///
+	/// Disposing of the returned disposable interrupts the producer, in which case
+	/// `completion` is invoked with `success`, unless it has been invoked already.
+	///
+	/// - parameters:
+	///   - completion: A closure to be invoked once, with `Result` when a
+	///                 `completion` or `failed` event is received.
+	///
+	/// - returns: A disposable to interrupt the producer.
+	@discardableResult
+	public func wait(completion: @escaping (Result<(), Error>) -> Void) -> Disposable {
+		return startWithOutcome(completion) { event, finish in
+			switch event {
+			case .value:
+				break
+			case let .failed(error):
+				finish(.failure(error))
+			case .completed, .interrupted:
+				finish(.success(()))
+			}
+		}
+	}
+
+	/// Start the producer, and feed its events to `reduce` until it finishes with an
+	/// outcome, at which point the producer is interrupted.
+	///
+	/// - parameters:
+	///   - completion: A closure to be invoked once, with the outcome.
+	///   - reduce: A closure to be invoked with every event, until it invokes the
+	///             given closure with the outcome. Every event which terminates the
+	///             producer must finish it.
+	///
+	/// - returns: A disposable to interrupt the producer.
+	private func startWithOutcome<Outcome>(
+		_ completion: @escaping (Outcome) -> Void,
+		_ reduce: @escaping (Signal<Value, Error>.Event, _ finish: (Outcome) -> Void) -> Void
+	) -> Disposable {
+		return startWithSignal { signal, interruptHandle in
+			// The events of a signal are serialized, so that the flag needs no
+			// synchronization.
+			var isFinished = false
+
+			signal.observe { event in
+				guard !isFinished else { return }
+
+				reduce(event) { outcome in
+					isFinished = true
+					interruptHandle.dispose()
+					completion(outcome)
+				}
+			}
+
+			return interruptHandle
+		}
+	}
+
+	/// Block the calling thread until the outcome of an operation is determined.
+	///
+	/// - parameters:
+	///   - start: A closure starting the operation, which invokes the given closure
+	///            with its outcome.
+	///
+	/// - returns: The outcome.
+	private func blockUntilFinished<Outcome>(_ start: (@escaping (Outcome) -> Void) -> Disposable) -> Outcome {
+		let semaphore = DispatchSemaphore(value: 0)
+		var outcome: Outcome?
+
+		_ = start { result in
+			outcome = result
+			semaphore.signal()
+		}
+
+		semaphore.wait()
+		return outcome!
 	}
 
 	/// Creates a new `SignalProducer` that will multicast values emitted by
@@ -2680,6 +3093,19 @@ extension SignalProducer {
 		let lifetime = Lifetime(lifetimeToken)
 
 		let state = Atomic(ReplayState<Value, Error>(upTo: capacity))
+		let buffered = SignalMetrics.gauge(named: "replayLazily")
+
+		if isMemoryAccountingEnabled {
+			MemoryAccounting.track(state, kind: "replayLazily") { state in
+				state.estimatedFootprint + state.withValue { $0.estimatedFootprint }
+			}
+		}
+
+		if let buffered = buffered {
+			lifetime.observeEnded {
+				buffered.add(-state.value.values.count)
+			}
+		}
 
 		let start: Atomic<(() -> Void)?> = Atomic {
 			// Start the underlying producer.
@@ -2687,7 +3113,11 @@ extension SignalProducer {
 				.take(during: lifetime)
 				.start { event in
 					let observers: Bag<Signal<Value, Error>.Observer>? = state.modify { state in
-						defer { state.enqueue(event) }
+						defer {
+							let count = state.values.count
+							state.enqueue(event)
+							buffered?.add(state.values.count - count)
+						}
 						return state.observers
 					}
 					observers?.forEach { $0.send(event) }
@@ -2854,6 +3284,20 @@ extension SignalProducer where Value == Bool {
 	}
 }
 
+/// The state of a producer started by `repeat`, `retry` or `then`, or of a batch
+/// scheduled by a batched producer, which determines whether its termination is
+/// handled by the starting thread once the producer has returned from being started.
+private enum StartingState: Int32 {
+	/// The producer is being started.
+	case starting
+
+	/// The producer has returned from being started without having terminated.
+	case started
+
+	/// The producer has terminated while being started.
+	case completed
+}
+
 /// Represents a recoverable error of an observer not being ready for an
 /// attachment to a `ReplayState`, and the observer should replay the supplied
 /// values before attempting to observe again.
@@ -2889,6 +3333,19 @@ private struct ReplayState<Value, Error: Swift.Error> {
 		self.capacity = capacity
 	}
 
+	/// The estimated bytes of the buffers held by the replay state.
+	var estimatedFootprint: Int {
+		let replayBuffers = self.replayBuffers.values.reduce(0) { $0 + MemoryEstimate.array($1) }
+		let replayBufferTable = self.replayBuffers.isEmpty
+			? 0
+			: MemoryEstimate.dictionary(self.replayBuffers)
+
+		return MemoryEstimate.array(values)
+			+ (observers?.estimatedFootprint ?? 0)
+			+ replayBuffers
+			+ replayBufferTable
+	}
+
 	/// Attempt to observe the replay state.
 	///
 	/// - warning: Repeatedly observing the replay state with the same observer
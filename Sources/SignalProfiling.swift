@@ -0,0 +1,393 @@
+import Dispatch
+import Foundation
+#if os(iOS) || os(macOS) || os(tvOS) || os(watchOS)
+import Darwin.POSIX.pthread
+#else
+import Glibc
+#endif
+
+/// The switch of `SignalProfiling`, which is nonzero while `profiled` stages enter
+/// their regions.
+private let signalProfilingSwitch = AtomicInt32(0)
+
+/// `SignalProfiling` attributes the time spent delivering events to the call sites
+/// which have opted in with `profiled(_:file:line:)`.
+///
+/// A `profiled` stage identifies a region by its name, and the file and line at which
+/// it has been applied. When profiling is enabled, the stage enters the region while
+/// it delivers an event downstream, so the time spent by the operators and observers
+/// downstream of it is attributed to the region. Regions nest when an event reaches
+/// another `profiled` stage.
+///
+/// ```
+/// SignalProfiling.start()
+///
+/// signal
+///     .profiled("render")
+///     .map(render)
+///     .observeValues(display)
+/// ```
+///
+/// The regions entered by a thread can be sampled by a `SignalSampler`, or forwarded
+/// to an external profiler, e.g. as `os_signpost` intervals, through the hooks
+/// supplied to `start(willEnter:didExit:)`.
+public enum SignalProfiling {
+	private static let lock = Lock.make()
+	private static var threads: [SignalProfilingThreadState] = []
+
+	/// The hooks supplied to `start(willEnter:didExit:)`, which are replaced as a
+	/// whole, so that a region reads them once.
+	private static let hooks = Atomic<SignalProfilingHooks?>(nil)
+
+	/// Whether `profiled` stages enter their regions.
+	public static var isEnabled: Bool {
+		return signalProfilingSwitch.load() != 0
+	}
+
+	/// The regions entered by the current thread, from the outermost to the innermost.
+	public static var currentRegions: [SignalProfilingRegion] {
+		return SignalProfilingThreadState.current.regions
+	}
+
+	/// Start entering the regions of `profiled` stages.
+	///
+	/// - parameters:
+	///   - willEnter: An action invoked on the calling thread whenever a region is
+	///                entered.
+	///   - didExit: An action invoked on the calling thread whenever a region is
+	///              exited.
+	public static func start(
+		willEnter: ((SignalProfilingRegion) -> Void)? = nil,
+		didExit: ((SignalProfilingRegion) -> Void)? = nil
+	) {
+		hooks.value = (willEnter == nil && didExit == nil)
+			? nil
+			: SignalProfilingHooks(willEnter: willEnter, didExit: didExit)
+		signalProfilingSwitch.store(1)
+	}
+
+	/// Stop entering regions.
+	public static func stop() {
+		signalProfilingSwitch.store(0)
+		hooks.value = nil
+	}
+
+	/// Perform an action within the given region, if profiling is enabled.
+	///
+	/// - parameters:
+	///   - region: The region.
+	///   - action: The action.
+	internal static func perform(in region: SignalProfilingRegion, _ action: () -> Void) {
+		guard isEnabled else { return action() }
+
+		let state = SignalProfilingThreadState.current
+		let hooks = self.hooks.value
+
+		state.enter(region, hooks: hooks)
+		defer { state.exit(region, hooks: hooks) }
+
+		action()
+	}
+
+	/// Take a sample of the regions entered by every thread.
+	///
+	/// - returns: The regions of every thread which has entered at least one.
+	fileprivate static func sample() -> [[SignalProfilingRegion]] {
+		lock.lock()
+		defer { lock.unlock() }
+
+		return threads.compactMap { state in
+			let regions = state.regions
+			return regions.isEmpty ? nil : regions
+		}
+	}
+
+	fileprivate static func register(_ state: SignalProfilingThreadState) {
+		lock.lock()
+		threads.append(state)
+		lock.unlock()
+	}
+
+	fileprivate static func unregister(_ state: SignalProfilingThreadState) {
+		lock.lock()
+		threads.removeAll { $0 === state }
+		lock.unlock()
+	}
+}
+
+/// A region of a pipeline, identified by its name and the location at which its
+/// `profiled` stage has been applied.
+public struct SignalProfilingRegion: Hashable, CustomStringConvertible {
+	private let staticName: StaticString
+	private let filePath: StaticString
+
+	/// The line at which the stage has been applied.
+	public let line: UInt
+
+	/// The name of the region.
+	public var name: String {
+		return "\(staticName)"
+	}
+
+	/// The name of the file in which the stage has been applied.
+	public var file: String {
+		let path = "\(filePath)"
+		return path.split(separator: "/").last.map(String.init) ?? path
+	}
+
+	public var description: String {
+		return "\(name) at \(file):\(line)"
+	}
+
+	internal init(name: StaticString, file: StaticString, line: UInt) {
+		self.staticName = name
+		self.filePath = file
+		self.line = line
+	}
+
+	public static func == (left: SignalProfilingRegion, right: SignalProfilingRegion) -> Bool {
+		return left.line == right.line
+			&& left.name == right.name
+			&& "\(left.filePath)" == "\(right.filePath)"
+	}
+
+	public func hash(into hasher: inout Hasher) {
+		hasher.combine(line)
+		hasher.combine(name)
+		hasher.combine("\(filePath)")
+	}
+}
+
+/// `SignalSampler` periodically samples the regions entered by every thread, and
+/// aggregates the samples into a `SignalProfile`.
+///
+/// ```
+/// SignalProfiling.start()
+/// let sampler = SignalSampler(interval: .milliseconds(1))
+/// sampler.start()
+///
+/// // Run the workload.
+///
+/// let profile = sampler.stop()
+/// try profile.collapsed().write(toFile: "signals.folded", atomically: true, encoding: .utf8)
+/// ```
+///
+/// - note: A thread is sampled only while it is in a region. Time spent in the
+///         library itself is attributed to the innermost region entered.
+public final class SignalSampler {
+	private let interval: DispatchTimeInterval
+	private let queue = DispatchQueue(label: "org.reactivecocoa.ReactiveSwift.SignalSampler")
+	private let lock = Lock.make()
+	private let finished = DispatchSemaphore(value: 0)
+	private var isRunning = false
+	private var stacks: [[SignalProfilingRegion]: Int] = [:]
+	private var sampleCount = 0
+
+	/// Create a sampler.
+	///
+	/// - parameters:
+	///   - interval: The interval between samples.
+	public init(interval: DispatchTimeInterval = .milliseconds(1)) {
+		self.interval = interval
+	}
+
+	/// Start sampling on a background thread. Samples taken by a previous run are
+	/// discarded.
+	public func start() {
+		lock.lock()
+		guard !isRunning else {
+			lock.unlock()
+			return
+		}
+		isRunning = true
+		stacks = [:]
+		sampleCount = 0
+		lock.unlock()
+
+		queue.async { [interval] in
+			while true {
+				Thread.sleep(forTimeInterval: interval.timeInterval)
+
+				let samples = SignalProfiling.sample()
+
+				self.lock.lock()
+				guard self.isRunning else {
+					self.lock.unlock()
+					break
+				}
+				self.sampleCount += 1
+				for regions in samples {
+					self.stacks[regions, default: 0] += 1
+				}
+				self.lock.unlock()
+			}
+
+			self.finished.signal()
+		}
+	}
+
+	/// Stop sampling, and wait for the background thread to finish.
+	///
+	/// - returns: The profile of the samples taken since the sampler has started.
+	@discardableResult
+	public func stop() -> SignalProfile {
+		lock.lock()
+		let wasRunning = isRunning
+		isRunning = false
+		lock.unlock()
+
+		if wasRunning {
+			finished.wait()
+		}
+
+		lock.lock()
+		defer { lock.unlock() }
+		return SignalProfile(stacks: stacks, sampleCount: sampleCount)
+	}
+}
+
+/// The samples taken by a `SignalSampler`.
+public struct SignalProfile {
+	/// The number of samples of every stack of regions, from the outermost to the
+	/// innermost region.
+	public let stacks: [[SignalProfilingRegion]: Int]
+
+	/// The number of times the threads have been sampled. A sample of a thread outside
+	/// any region is not counted in `stacks`.
+	public let sampleCount: Int
+
+	/// The number of samples in which a region was the innermost region.
+	public var selfSamples: [SignalProfilingRegion: Int] {
+		var samples: [SignalProfilingRegion: Int] = [:]
+		for (regions, count) in stacks {
+			samples[regions[regions.count - 1], default: 0] += count
+		}
+		return samples
+	}
+
+	/// The number of samples in which a region was entered, including the samples of
+	/// the regions nested in it.
+	public var totalSamples: [SignalProfilingRegion: Int] {
+		var samples: [SignalProfilingRegion: Int] = [:]
+		for (regions, count) in stacks {
+			for region in Set(regions) {
+				samples[region, default: 0] += count
+			}
+		}
+		return samples
+	}
+
+	/// Export the stacks in the collapsed format, which is accepted by flame graph
+	/// tools, e.g. `flamegraph.pl` or speedscope.
+	///
+	/// - returns: A line for every stack, with the regions separated by semicolons
+	///            and followed by the number of samples.
+	public func collapsed() -> String {
+		return stacks
+			.map { regions, count in
+				regions.map { $0.description.replacingOccurrences(of: ";", with: ",") }.joined(separator: ";") + " \(count)"
+			}
+			.sorted()
+			.joined(separator: "\n")
+	}
+}
+
+/// The hooks forwarding the regions entered and exited to an external profiler.
+private final class SignalProfilingHooks {
+	let willEnter: ((SignalProfilingRegion) -> Void)?
+	let didExit: ((SignalProfilingRegion) -> Void)?
+
+	init(willEnter: ((SignalProfilingRegion) -> Void)?, didExit: ((SignalProfilingRegion) -> Void)?) {
+		self.willEnter = willEnter
+		self.didExit = didExit
+	}
+}
+
+/// The regions entered by a thread. The lock is acquired by the owning thread when it
+/// enters or exits a region, and is contended only when the thread is being sampled.
+private final class SignalProfilingThreadState {
+	private let lock = Lock.make()
+	private var stack: [SignalProfilingRegion] = []
+
+	var regions: [SignalProfilingRegion] {
+		lock.lock()
+		defer { lock.unlock() }
+		return stack
+	}
+
+	func enter(_ region: SignalProfilingRegion, hooks: SignalProfilingHooks?) {
+		lock.lock()
+		stack.append(region)
+		lock.unlock()
+
+		hooks?.willEnter?(region)
+	}
+
+	func exit(_ region: SignalProfilingRegion, hooks: SignalProfilingHooks?) {
+		hooks?.didExit?(region)
+
+		lock.lock()
+		stack.removeLast()
+		lock.unlock()
+	}
+
+	private static let key: pthread_key_t = {
+		var key = pthread_key_t()
+		let status = pthread_key_create(&key) { pointer in
+			#if os(Linux)
+			guard let pointer = pointer else { return }
+			#endif
+			let state = Unmanaged<SignalProfilingThreadState>.fromOpaque(pointer).takeRetainedValue()
+			SignalProfiling.unregister(state)
+		}
+		precondition(status == 0, "Unexpected pthread key error code: \(status)")
+		return key
+	}()
+
+	static var current: SignalProfilingThreadState {
+		if let pointer = pthread_getspecific(key) {
+			return Unmanaged<SignalProfilingThreadState>.fromOpaque(pointer).takeUnretainedValue()
+		}
+
+		let state = SignalProfilingThreadState()
+		SignalProfiling.register(state)
+		pthread_setspecific(key, Unmanaged.passRetained(state).toOpaque())
+		return state
+	}
+}
+
+extension Signal {
+	/// Attribute the time spent delivering the events of `self` downstream to a
+	/// region of `SignalProfiling`, while profiling is enabled.
+	///
+	/// - parameters:
+	///   - name: The name of the region.
+	///   - file: The file in which the stage is applied.
+	///   - line: The line at which the stage is applied.
+	///
+	/// - returns: A signal that forwards the events of `self`.
+	public func profiled(_ name: StaticString = "profiled", file: StaticString = #file, line: UInt = #line) -> Signal<Value, Error> {
+		let region = SignalProfilingRegion(name: name, file: file, line: line)
+
+		return Signal { observer, lifetime in
+			lifetime += self.observe { event in
+				SignalProfiling.perform(in: region) { observer.send(event) }
+			}
+		}
+	}
+}
+
+extension SignalProducer {
+	/// Attribute the time spent delivering the events of the produced `Signal`
+	/// downstream to a region of `SignalProfiling`, while profiling is enabled.
+	///
+	/// - parameters:
+	///   - name: The name of the region.
+	///   - file: The file in which the stage is applied.
+	///   - line: The line at which the stage is applied.
+	///
+	/// - returns: A producer that forwards the events of `self`.
+	public func profiled(_ name: StaticString = "profiled", file: StaticString = #file, line: UInt = #line) -> SignalProducer<Value, Error> {
+		return lift { $0.profiled(name, file: file, line: line) }
+	}
+}
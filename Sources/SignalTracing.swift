@@ -0,0 +1,376 @@
+import Dispatch
+import Foundation
+#if os(iOS) || os(macOS) || os(tvOS) || os(watchOS)
+import Darwin.POSIX.pthread
+#else
+import Glibc
+#endif
+
+/// The generation of the tracing session in which `Signal`s record the events they
+/// deliver, or zero if tracing is disabled. It is loaded on every event delivery,
+/// so that tracing costs a single atomic load and branch when it is disabled.
+internal let signalTracingSession = AtomicInt32(0)
+
+/// `SignalTracing` records the events delivered by all `Signal`s as compact binary
+/// records, and exports them in a format of choice.
+///
+/// Unlike `logEvents`, tracing does not build any string or capture any source
+/// location. Each thread records into its own fixed capacity ring buffer, guarded
+/// by a lock which is contended only while the records are being collected. When a
+/// buffer is full, the oldest records of the thread are overwritten.
+///
+/// ```
+/// SignalTracing.start()
+/// // Run the workload.
+/// SignalTracing.stop()
+///
+/// let trace = SignalTracing.export(using: ChromeTraceExporter())
+/// ```
+public enum SignalTracing {
+	private static let lock = Lock.make()
+	private static var buffers: [SignalTraceBuffer] = []
+	private static var capacity = 0
+	private static var generation: Int32 = 0
+
+	/// Whether events are being recorded.
+	public static var isEnabled: Bool {
+		return signalTracingSession.load() != 0
+	}
+
+	/// Start recording events on all threads, discarding any record previously made.
+	///
+	/// - parameters:
+	///   - capacityPerThread: The maximum number of records kept for each thread.
+	public static func start(capacityPerThread: Int = 8192) {
+		precondition(capacityPerThread > 0, "The capacity must be positive.")
+
+		lock.lock()
+		capacity = capacityPerThread
+		generation = generation == .max ? 1 : generation + 1
+		buffers.removeAll { $0.isRetired }
+		signalTracingSession.store(generation)
+		lock.unlock()
+	}
+
+	/// Stop recording events. The records made so far are kept until they are
+	/// collected, or tracing is started again.
+	public static func stop() {
+		lock.lock()
+		signalTracingSession.store(0)
+		lock.unlock()
+	}
+
+	/// Collect the records made on all threads, and clear them.
+	///
+	/// - note: A record made concurrently with the collection is either collected, or
+	///         kept for the next collection. Call `stop()` before collecting to get
+	///         a trace ending at a consistent point.
+	///
+	/// - returns: The records, ordered by their timestamps.
+	public static func collect() -> [SignalTraceRecord] {
+		lock.lock()
+		defer { lock.unlock() }
+
+		var records: [SignalTraceRecord] = []
+		for buffer in buffers where buffer.generation == generation {
+			buffer.drain(into: &records)
+		}
+		buffers.removeAll { $0.isRetired }
+
+		records.sort { $0.timestamp < $1.timestamp }
+		return records
+	}
+
+	/// Collect the records made on all threads, clear them, and export them using the
+	/// given exporter.
+	///
+	/// - parameters:
+	///   - exporter: The exporter to encode the records.
+	///
+	/// - returns: The encoded trace.
+	public static func export<Exporter: SignalTraceExporter>(using exporter: Exporter) -> Data {
+		return exporter.export(collect())
+	}
+
+	/// Record an event delivered by a signal on the current thread.
+	///
+	/// - parameters:
+	///   - signal: The identity of the signal.
+	///   - kind: The kind of the event.
+	///   - session: The generation of the tracing session, as loaded from
+	///              `signalTracingSession`.
+	internal static func record(signal: AnyObject, kind: SignalTraceRecord.Kind, session: Int32) {
+		let timestamp = DispatchTime.now().uptimeNanoseconds
+		currentBuffer(session: session).append(SignalTraceRecord(
+			signal: UInt64(UInt(bitPattern: ObjectIdentifier(signal))),
+			kind: kind,
+			timestamp: timestamp,
+			thread: 0
+		))
+	}
+
+	private static let key: pthread_key_t = {
+		var key = pthread_key_t()
+		let status = pthread_key_create(&key) { pointer in
+			#if os(Linux)
+			guard let pointer = pointer else { return }
+			#endif
+			let buffer = Unmanaged<SignalTraceBuffer>.fromOpaque(pointer).takeRetainedValue()
+			SignalTracing.lock.lock()
+			buffer.isRetired = true
+			SignalTracing.lock.unlock()
+		}
+		precondition(status == 0, "Unexpected pthread key error code: \(status)")
+		return key
+	}()
+
+	private static var nextThread: UInt64 = 0
+
+	/// The buffer of the current thread for the given tracing session, created on
+	/// demand.
+	private static func currentBuffer(session: Int32) -> SignalTraceBuffer {
+		if let pointer = pthread_getspecific(key) {
+			let buffer = Unmanaged<SignalTraceBuffer>.fromOpaque(pointer).takeUnretainedValue()
+			if buffer.generation == session {
+				return buffer
+			}
+
+			// Replace the buffer of a previous tracing session.
+			pthread_setspecific(key, nil)
+			Unmanaged<SignalTraceBuffer>.fromOpaque(pointer).release()
+			lock.lock()
+			buffer.isRetired = true
+			lock.unlock()
+		}
+
+		lock.lock()
+		nextThread += 1
+		let buffer = SignalTraceBuffer(thread: nextThread, capacity: capacity, generation: session)
+		buffers.append(buffer)
+		lock.unlock()
+
+		pthread_setspecific(key, Unmanaged.passRetained(buffer).toOpaque())
+		return buffer
+	}
+}
+
+/// A record of an event delivered by a `Signal`.
+public struct SignalTraceRecord: Equatable {
+	/// The kind of an event.
+	public enum Kind: UInt8 {
+		case value
+		case failed
+		case completed
+		case interrupted
+	}
+
+	/// The identity of the signal. It is unique among the signals alive at the same
+	/// time, but may be reused after a signal has deinitialized.
+	public let signal: UInt64
+
+	/// The kind of the event.
+	public let kind: Kind
+
+	/// The time at which the event was sent, in nanoseconds since an arbitrary
+	/// point in time. It is monotonic.
+	public let timestamp: UInt64
+
+	/// The identity of the thread, which starts from 1 for every tracing session.
+	public let thread: UInt64
+
+	public init(signal: UInt64, kind: Kind, timestamp: UInt64, thread: UInt64) {
+		self.signal = signal
+		self.kind = kind
+		self.timestamp = timestamp
+		self.thread = thread
+	}
+}
+
+extension SignalTraceRecord.Kind {
+	internal init<Value, Error>(_ event: Signal<Value, Error>.Event) {
+		switch event {
+		case .value:
+			self = .value
+		case .failed:
+			self = .failed
+		case .completed:
+			self = .completed
+		case .interrupted:
+			self = .interrupted
+		}
+	}
+}
+
+/// A fixed capacity ring buffer of trace records, which is written only by its
+/// owning thread. The records are guarded by `lock`, so that they can be drained
+/// by any thread.
+private final class SignalTraceBuffer {
+	let thread: UInt64
+	let generation: Int32
+
+	/// Whether the owning thread has exited, or has moved on to a new buffer. It is
+	/// accessed only with the `SignalTracing` lock acquired.
+	var isRetired = false
+
+	private let lock = Lock.make("SignalTraceBuffer.lock")
+	private let capacity: Int
+	private let storage: UnsafeMutablePointer<SignalTraceRecord>
+
+	/// The number of records written since the buffer was last drained.
+	private var count = 0
+
+	init(thread: UInt64, capacity: Int, generation: Int32) {
+		self.thread = thread
+		self.capacity = capacity
+		self.generation = generation
+		storage = UnsafeMutablePointer.allocate(capacity: capacity)
+	}
+
+	deinit {
+		storage.deinitialize(count: min(count, capacity))
+		storage.deallocate()
+	}
+
+	func append(_ record: SignalTraceRecord) {
+		lock.lock()
+		defer { lock.unlock() }
+
+		let slot = storage + count % capacity
+		if count < capacity {
+			slot.initialize(to: record)
+		} else {
+			slot.pointee = record
+		}
+		count += 1
+	}
+
+	func drain(into records: inout [SignalTraceRecord]) {
+		lock.lock()
+		defer { lock.unlock() }
+
+		let count = self.count
+		let start = count > capacity ? count % capacity : 0
+
+		for offset in 0 ..< min(count, capacity) {
+			let record = storage[(start + offset) % capacity]
+			records.append(SignalTraceRecord(signal: record.signal, kind: record.kind, timestamp: record.timestamp, thread: thread))
+		}
+
+		storage.deinitialize(count: min(count, capacity))
+		self.count = 0
+	}
+}
+
+/// Encodes trace records.
+public protocol SignalTraceExporter {
+	/// Encode the given records.
+	///
+	/// - parameters:
+	///   - records: The records ordered by their timestamps.
+	///
+	/// - returns: The encoded trace.
+	func export(_ records: [SignalTraceRecord]) -> Data
+}
+
+/// Encodes trace records in the Chrome trace event format, which can be loaded in
+/// `chrome://tracing` or Perfetto. Every record is an instant event on the track of
+/// its thread.
+public struct ChromeTraceExporter: SignalTraceExporter {
+	public init() {}
+
+	public func export(_ records: [SignalTraceRecord]) -> Data {
+		var json = "{\"traceEvents\":["
+
+		for (index, record) in records.enumerated() {
+			if index > 0 {
+				json += ","
+			}
+
+			let microseconds = Double(record.timestamp) / 1_000
+			json += "{\"name\":\"\(record.kind)\",\"cat\":\"signal\",\"ph\":\"i\",\"s\":\"t\""
+			json += ",\"ts\":\(microseconds),\"pid\":1,\"tid\":\(record.thread)"
+			json += ",\"args\":{\"signal\":\"0x\(String(record.signal, radix: 16))\"}}"
+		}
+
+		json += "]}"
+		return Data(json.utf8)
+	}
+}
+
+/// Encodes trace records in a compact binary format.
+///
+/// The trace starts with the magic bytes `RSTR`, followed by the format version and
+/// the number of records as little endian `UInt32`s. Each record then takes 25 bytes:
+/// the signal, the timestamp and the thread as little endian `UInt64`s, followed by
+/// the kind as a byte.
+public struct BinaryTraceExporter: SignalTraceExporter {
+	private static let magic = Array("RSTR".utf8)
+	private static let version: UInt32 = 1
+	private static let recordSize = 25
+
+	public init() {}
+
+	public func export(_ records: [SignalTraceRecord]) -> Data {
+		var data = Data(capacity: 12 + records.count * BinaryTraceExporter.recordSize)
+		data.append(contentsOf: BinaryTraceExporter.magic)
+		data.appendLittleEndian(BinaryTraceExporter.version)
+		data.appendLittleEndian(UInt32(records.count))
+
+		for record in records {
+			data.appendLittleEndian(record.signal)
+			data.appendLittleEndian(record.timestamp)
+			data.appendLittleEndian(record.thread)
+			data.append(record.kind.rawValue)
+		}
+
+		return data
+	}
+
+	/// Decode a trace encoded by `export(_:)`.
+	///
+	/// - parameters:
+	///   - data: The encoded trace.
+	///
+	/// - returns: The records, or `nil` if `data` is not a valid trace.
+	public static func decode(_ data: Data) -> [SignalTraceRecord]? {
+		let bytes = [UInt8](data)
+
+		func readLittleEndian<Integer: FixedWidthInteger>(at offset: Int, as type: Integer.Type) -> Integer {
+			return (0 ..< MemoryLayout<Integer>.size).reduce(0) { value, index in
+				value | Integer(bytes[offset + index]) << (index * 8)
+			}
+		}
+
+		guard bytes.count >= 12,
+			Array(bytes[0 ..< 4]) == magic,
+			readLittleEndian(at: 4, as: UInt32.self) == version
+		else { return nil }
+
+		let count = Int(readLittleEndian(at: 8, as: UInt32.self))
+		guard bytes.count == 12 + count * recordSize else { return nil }
+
+		var records: [SignalTraceRecord] = []
+		records.reserveCapacity(count)
+
+		for index in 0 ..< count {
+			let offset = 12 + index * recordSize
+			guard let kind = SignalTraceRecord.Kind(rawValue: bytes[offset + 24]) else { return nil }
+
+			records.append(SignalTraceRecord(
+				signal: readLittleEndian(at: offset, as: UInt64.self),
+				kind: kind,
+				timestamp: readLittleEndian(at: offset + 8, as: UInt64.self),
+				thread: readLittleEndian(at: offset + 16, as: UInt64.self)
+			))
+		}
+
+		return records
+	}
+}
+
+extension Data {
+	fileprivate mutating func appendLittleEndian<Integer: FixedWidthInteger>(_ value: Integer) {
+		var value = value.littleEndian
+		Swift.withUnsafeBytes(of: &value) { append(contentsOf: $0) }
+	}
+}
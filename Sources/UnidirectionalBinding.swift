@@ -143,15 +143,41 @@ public struct BindingTarget<Value>: BindingTargetProvider {
 	/// If no scheduler is specified, the binding target would consume the value
 	/// immediately.
 	///
+	/// - note: Values delivered on `UIScheduler` are coalesced. See
+	///         `init(on:coalescing:lifetime:action:)` for details.
+	///
 	/// - parameters:
 	///   - scheduler: The scheduler on which the `action` consumes the values.
 	///   - lifetime: The expected lifetime of any bindings towards `self`.
 	///   - action: The action to consume values.
 	public init(on scheduler: Scheduler = ImmediateScheduler(), lifetime: Lifetime, action: @escaping (Value) -> Void) {
+		self.init(on: scheduler, coalescing: scheduler is UIScheduler, lifetime: lifetime, action: action)
+	}
+
+	/// Creates a binding target which consumes values on the specified scheduler,
+	/// optionally coalescing values that arrive faster than the scheduler can
+	/// deliver them.
+	///
+	/// When coalescing, the binding target retains only the latest value pending for
+	/// delivery, and has at most one delivery scheduled at a time. A value replacing
+	/// a pending one would not be delivered on its own, so `action` receives only the
+	/// latest value available as of the time the scheduled delivery runs.
+	///
+	/// - note: Coalescing has no effect with `ImmediateScheduler`, which consumes
+	///         values as they arrive.
+	///
+	/// - parameters:
+	///   - scheduler: The scheduler on which the `action` consumes the values.
+	///   - coalescing: Whether values pending for delivery should be coalesced.
+	///   - lifetime: The expected lifetime of any bindings towards `self`.
+	///   - action: The action to consume values.
+	public init(on scheduler: Scheduler, coalescing: Bool, lifetime: Lifetime, action: @escaping (Value) -> Void) {
 		self.lifetime = lifetime
 
 		if scheduler is ImmediateScheduler {
 			self.action = action
+		} else if coalescing {
+			self.action = CoalescingDelivery(scheduler: scheduler, action: action).send
 		} else {
 			self.action = { value in
 				scheduler.schedule {
@@ -174,6 +200,66 @@ public struct BindingTarget<Value>: BindingTargetProvider {
 	public init<Object: AnyObject>(on scheduler: Scheduler = ImmediateScheduler(), lifetime: Lifetime, object: Object, keyPath: WritableKeyPath<Object, Value>) {
 		self.init(on: scheduler, lifetime: lifetime) { [weak object] in object?[keyPath: keyPath] = $0 }
 	}
+
+	/// Creates a binding target which consumes values on the specified scheduler,
+	/// optionally coalescing values that arrive faster than the scheduler can
+	/// deliver them.
+	///
+	/// - parameters:
+	///   - scheduler: The scheduler on which the key path consumes the values.
+	///   - coalescing: Whether values pending for delivery should be coalesced.
+	///   - lifetime: The expected lifetime of any bindings towards `self`.
+	///   - object: The object to consume values.
+	///   - keyPath: The key path of the object that consumes values.
+	public init<Object: AnyObject>(on scheduler: Scheduler, coalescing: Bool, lifetime: Lifetime, object: Object, keyPath: WritableKeyPath<Object, Value>) {
+		self.init(on: scheduler, coalescing: coalescing, lifetime: lifetime) { [weak object] in object?[keyPath: keyPath] = $0 }
+	}
+}
+
+/// Delivers values to an action on a scheduler, keeping only the latest value
+/// pending for delivery.
+private final class CoalescingDelivery<Value> {
+	private let scheduler: Scheduler
+	private let action: (Value) -> Void
+
+	/// The value pending for delivery. A delivery has been scheduled if, and only
+	/// if, it is not `nil`.
+	private let pending = Atomic<Value?>(nil)
+
+	init(scheduler: Scheduler, action: @escaping (Value) -> Void) {
+		self.scheduler = scheduler
+		self.action = action
+	}
+
+	func send(_ value: Value) {
+		let needsDelivery: Bool = pending.modify { pending in
+			defer { pending = value }
+			return pending == nil
+		}
+
+		guard needsDelivery else { return }
+
+		// A scheduler returns `nil` both when it has run the delivery immediately
+		// and when it refuses the work. The first of the delivery and the check
+		// below claims the attempt, so that a refused delivery drops the pending
+		// value instead of blocking every later value.
+		let isClaimed = Atomic(false)
+		let disposable = scheduler.schedule {
+			if !isClaimed.swap(true) {
+				self.deliver()
+			}
+		}
+
+		if disposable == nil && !isClaimed.swap(true) {
+			pending.value = nil
+		}
+	}
+
+	private func deliver() {
+		if let value = pending.swap(nil) {
+			action(value)
+		}
+	}
 }
 
 extension Optional: BindingTargetProvider where Wrapped: BindingTargetProvider {
@@ -1,3 +1,5 @@
+import Foundation
+
 /// A mutable property that validates mutations before committing them.
 ///
 /// If the property wraps an arbitrary mutable property, changes originated from
@@ -111,6 +113,114 @@ public final class ValidatingProperty<Value, ValidationError: Swift.Error>: Muta
 		self.init(MutableProperty(initial), validator)
 	}
 
+	/// Create a `ValidatingProperty` that presents a mutable validating
+	/// view for an inner mutable property, and validates proposed values
+	/// asynchronously on the given scheduler.
+	///
+	/// Setting `value` returns immediately, and the proposed value is committed
+	/// once `validator` decides on it. `result` is updated when a validation
+	/// finishes. A validation is discarded if a newer value has been proposed, or
+	/// the inner property has changed in the meantime.
+	///
+	/// No lock is held while `validator` runs, so neither writers nor the inner
+	/// property are stalled by an expensive validation.
+	///
+	/// - note: `inner` is retained by the created property.
+	///
+	/// - note: The initial value of `inner` is validated synchronously.
+	///
+	/// - parameters:
+	///   - inner: The inner property which validated values are committed to.
+	///   - scheduler: The scheduler on which `validator` runs.
+	///   - validator: The closure to invoke for any proposed value to `self`.
+	public convenience init<Inner: ComposableMutablePropertyProtocol>(
+		_ inner: Inner,
+		on scheduler: Scheduler,
+		_ validator: @escaping (Value) -> Decision
+	) where Inner.Value == Value {
+		self.init(inner, validator, scheduling: { scheduler.schedule($0) })
+	}
+
+	/// Create a `ValidatingProperty` that presents a mutable validating
+	/// view for an inner mutable property, and validates proposed values
+	/// asynchronously on the given scheduler, after they have settled for the
+	/// given interval.
+	///
+	/// A validation is scheduled only after no value has been proposed for
+	/// `interval`. Otherwise, it behaves like `init(_:on:_:)`.
+	///
+	/// - note: `inner` is retained by the created property.
+	///
+	/// - note: The initial value of `inner` is validated synchronously.
+	///
+	/// - parameters:
+	///   - inner: The inner property which validated values are committed to.
+	///   - scheduler: The scheduler on which `validator` runs.
+	///   - interval: The interval for which proposed values must settle before
+	///               they are validated.
+	///   - validator: The closure to invoke for any proposed value to `self`.
+	public convenience init<Inner: ComposableMutablePropertyProtocol>(
+		_ inner: Inner,
+		on scheduler: DateScheduler,
+		debounce interval: TimeInterval,
+		_ validator: @escaping (Value) -> Decision
+	) where Inner.Value == Value {
+		self.init(inner, validator, scheduling: { action in
+			scheduler.schedule(after: scheduler.currentDate.addingTimeInterval(interval), action: action)
+		})
+	}
+
+	/// Create a `ValidatingProperty` that validates mutations asynchronously on
+	/// the given scheduler before committing them.
+	///
+	/// - parameters:
+	///   - initial: The initial value of the property. It is not required to
+	///              pass the validation as specified by `validator`.
+	///   - scheduler: The scheduler on which `validator` runs.
+	///   - validator: The closure to invoke for any proposed value to `self`.
+	public convenience init(
+		_ initial: Value,
+		on scheduler: Scheduler,
+		_ validator: @escaping (Value) -> Decision
+	) {
+		self.init(MutableProperty(initial), on: scheduler, validator)
+	}
+
+	/// Create a `ValidatingProperty` that validates mutations asynchronously on
+	/// the given scheduler, after they have settled for the given interval,
+	/// before committing them.
+	///
+	/// - parameters:
+	///   - initial: The initial value of the property. It is not required to
+	///              pass the validation as specified by `validator`.
+	///   - scheduler: The scheduler on which `validator` runs.
+	///   - interval: The interval for which proposed values must settle before
+	///               they are validated.
+	///   - validator: The closure to invoke for any proposed value to `self`.
+	public convenience init(
+		_ initial: Value,
+		on scheduler: DateScheduler,
+		debounce interval: TimeInterval,
+		_ validator: @escaping (Value) -> Decision
+	) {
+		self.init(MutableProperty(initial), on: scheduler, debounce: interval, validator)
+	}
+
+	private init<Inner: ComposableMutablePropertyProtocol>(
+		_ inner: Inner,
+		_ validator: @escaping (Value) -> Decision,
+		scheduling schedule: @escaping (@escaping () -> Void) -> Disposable?
+	) where Inner.Value == Value {
+		getter = { inner.value }
+		producer = inner.producer
+		signal = inner.signal
+		lifetime = inner.lifetime
+
+		let validation = AsynchronousValidation<Inner, ValidationError>(inner, validator, scheduling: schedule)
+		result = Property(capturing: validation.result)
+		setter = { validation.validate($0, writesBack: true) }
+	}
+
 	/// Create a `ValidatingProperty` that presents a mutable validating
 	/// view for an inner mutable property.
 	///
@@ -323,3 +433,76 @@ public final class ValidatingProperty<Value, ValidationError: Swift.Error>: Muta
 		}
 	}
 }
+
+/// The validation state of a `ValidatingProperty` that validates proposed values
+/// asynchronously.
+private final class AsynchronousValidation<Inner: ComposableMutablePropertyProtocol, ValidationError: Swift.Error> {
+	typealias Result = ValidatingProperty<Inner.Value, ValidationError>.Result
+
+	let result: MutableProperty<Result>
+
+	private let inner: Inner
+	private let validator: (Inner.Value) -> ValidatingProperty<Inner.Value, ValidationError>.Decision
+	private let schedule: (@escaping () -> Void) -> Disposable?
+
+	/// Every attempt, i.e. a proposed value or a change of the inner property,
+	/// bumps the generation. A validation commits its result only if no newer
+	/// attempt has been made.
+	private let generation = Atomic<UInt64>(0)
+
+	/// The validation which has been scheduled but not yet started.
+	private let pendingValidation = SerialDisposable()
+
+	/// This flag temporarily suspends the monitoring on the inner property for
+	/// writebacks that are triggered by successful validations. It is accessed
+	/// only with the lock of `inner` acquired.
+	private var isSettingInnerValue = false
+
+	init(
+		_ inner: Inner,
+		_ validator: @escaping (Inner.Value) -> ValidatingProperty<Inner.Value, ValidationError>.Decision,
+		scheduling schedule: @escaping (@escaping () -> Void) -> Disposable?
+	) {
+		self.inner = inner
+		self.validator = validator
+		self.schedule = schedule
+
+		let initial = inner.value
+		result = MutableProperty(Result(initial, validator(initial)))
+
+		inner.lifetime.observeEnded(pendingValidation.dispose)
+
+		// The inner property retains its signal, so the observer must not retain
+		// `self`, which in turn retains the inner property.
+		inner.signal.observeValues { [weak self] value in
+			guard let s = self, !s.isSettingInnerValue else { return }
+			s.validate(value, writesBack: false)
+		}
+	}
+
+	func validate(_ input: Inner.Value, writesBack: Bool) {
+		let attempt: UInt64 = generation.modify { generation in
+			generation += 1
+			return generation
+		}
+
+		// Replacing the pending validation cancels it, if it has not yet started.
+		pendingValidation.inner = schedule {
+			guard self.generation.value == attempt else { return }
+
+			let result = Result(input, self.validator(input))
+
+			self.inner.withValue { _ in
+				guard self.generation.value == attempt else { return }
+
+				self.result.value = result
+
+				if writesBack, let value = result.value {
+					self.isSettingInnerValue = true
+					self.inner.value = value
+					self.isSettingInnerValue = false
+				}
+			}
+		}
+	}
+}
@@ -7,15 +7,24 @@ Quick.QCKMain([
     ActionSpec.self,
     AtomicSpec.self,
     BagSpec.self,
+    CollectionPropertySpec.self,
     DisposableSpec.self,
     DeprecationSpec.self,
     FlattenSpec.self,
     FoundationExtensionsSpec.self,
     LifetimeSpec.self,
+    LockCheckingSpec.self,
+    MemoryAccountingSpec.self,
+    PipelineSpec.self,
     PropertySpec.self,
     SchedulerSpec.self,
+    SignalGraphSpec.self,
     SignalLifetimeSpec.self,
+    SignalMetricsSpec.self,
     SignalProducerLiftingSpec.self,
     SignalProducerSpec.self,
+    SignalProfilingSpec.self,
     SignalSpec.self,
+    SignalStressSpec.self,
+    SignalTracingSpec.self,
 ])
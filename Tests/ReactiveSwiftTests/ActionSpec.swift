@@ -300,6 +300,143 @@ class ActionSpec: QuickSpec {
 				}
 			}
 
+			describe("concurrent executions") {
+				var pool: Action<Int, Int, Never>!
+				var observers: [Int: Signal<Int, Never>.Observer] = [:]
+				var started: [Int] = []
+
+				func makePool(_ policy: ActionOverflowPolicy) {
+					pool = Action(state: Property(value: ()), enabledIf: { _ in true }, maximumConcurrentExecutions: 2, overflowPolicy: policy) { _, input in
+						SignalProducer { observer, _ in
+							started.append(input)
+							observers[input] = observer
+						}
+					}
+				}
+
+				beforeEach {
+					observers = [:]
+					started = []
+				}
+
+				it("should execute up to the limit concurrently and count the executions") {
+					makePool(.reject)
+
+					var counts: [Int] = []
+					pool.executionCount.producer.startWithValues { counts.append($0) }
+
+					pool.apply(1).start()
+					expect(pool.isEnabled.value) == true
+					pool.apply(2).start()
+					expect(pool.isEnabled.value) == false
+					expect(pool.isExecuting.value) == true
+
+					var isDisabled = false
+					pool.apply(3).startWithFailed { error in
+						if case .disabled = error { isDisabled = true }
+					}
+					expect(isDisabled) == true
+					expect(started) == [1, 2]
+
+					observers[1]!.sendCompleted()
+					expect(pool.isEnabled.value) == true
+
+					observers[2]!.sendCompleted()
+					expect(pool.isExecuting.value) == false
+					expect(counts) == [0, 1, 2, 1, 0]
+				}
+
+				it("should start waiting applications in order") {
+					makePool(.enqueue)
+
+					for input in 1 ... 4 {
+						pool.apply(input).start()
+					}
+
+					expect(pool.isEnabled.value) == true
+					expect(pool.executionCount.value) == 2
+					expect(started) == [1, 2]
+
+					observers[2]!.sendCompleted()
+					expect(started) == [1, 2, 3]
+
+					observers[1]!.sendCompleted()
+					expect(started) == [1, 2, 3, 4]
+					expect(pool.executionCount.value) == 2
+				}
+
+				it("should keep only the latest waiting application") {
+					makePool(.enqueueLatest)
+
+					var rejected: [Int] = []
+					for input in 1 ... 5 {
+						pool.apply(input).startWithFailed { _ in rejected.append(input) }
+					}
+
+					expect(rejected) == [3, 4]
+
+					observers[1]!.sendCompleted()
+					expect(started) == [1, 2, 5]
+				}
+
+				it("should not start a waiting application which has been interrupted") {
+					makePool(.enqueue)
+
+					pool.apply(1).start()
+					pool.apply(2).start()
+					let disposable = pool.apply(3).start()
+					pool.apply(4).start()
+
+					disposable.dispose()
+					observers[1]!.sendCompleted()
+
+					expect(started) == [1, 2, 4]
+				}
+
+				it("should release a waiting application once it is interrupted") {
+					final class Input {}
+
+					let queue = Action<Input, Never, Never>(state: Property(value: ()), enabledIf: { _ in true }, maximumConcurrentExecutions: 1, overflowPolicy: .enqueue) { _, _ in
+						.never
+					}
+
+					weak var weakInput: Input?
+
+					queue.apply(Input()).start()
+
+					let disposable: Disposable = {
+						let input = Input()
+						weakInput = input
+						return queue.apply(input).start()
+					}()
+
+					expect(weakInput).toNot(beNil())
+
+					disposable.dispose()
+					expect(weakInput).to(beNil())
+				}
+
+				it("should reject the waiting applications if disabled by the time a slot is freed") {
+					let isEnabled = MutableProperty(true)
+					pool = Action(state: isEnabled, enabledIf: { $0 }, maximumConcurrentExecutions: 1, overflowPolicy: .enqueue) { _, input in
+						SignalProducer { observer, _ in
+							started.append(input)
+							observers[input] = observer
+						}
+					}
+
+					var rejected = false
+					pool.apply(1).start()
+					pool.apply(2).startWithFailed { _ in rejected = true }
+
+					isEnabled.value = false
+					observers[1]!.sendCompleted()
+
+					expect(started) == [1]
+					expect(rejected) == true
+				}
+			}
+
 			describe("bindings") {
 				it("should execute successfully") {
 					var receivedValue: String?
@@ -8,7 +8,7 @@
 
 import Nimble
 import Quick
-import ReactiveSwift
+@testable import ReactiveSwift
 
 class BagSpec: QuickSpec {
 	override func spec() {
@@ -51,6 +51,64 @@ class BagSpec: QuickSpec {
 			expect(bag).toNot(contain("buzz"))
 		}
 		
+		it("should remove values in any order of insertion") {
+			let tokens = (0 ..< 10).map { bag.insert("\($0)") }
+
+			for index in [9, 0, 5, 4, 6, 1, 8, 2, 7, 3] {
+				expect(bag.remove(using: tokens[index])) == "\(index)"
+				expect(bag.remove(using: tokens[index])).to(beNil())
+				expect(bag).toNot(contain("\(index)"))
+			}
+
+			expect(bag.isEmpty) == true
+		}
+
+		it("should preserve the order of insertion across removals") {
+			let tokens = (0 ..< 10).map { bag.insert("\($0)") }
+
+			for index in [1, 3, 4, 8] {
+				bag.remove(using: tokens[index])
+			}
+
+			expect(Array(bag)) == ["0", "2", "5", "6", "7", "9"]
+			expect(bag.count) == 6
+			expect(bag.reversed()) == ["9", "7", "6", "5", "2", "0"]
+
+			for index in [0, 2, 5] {
+				bag.remove(using: tokens[index])
+			}
+
+			bag.insert("10")
+			expect(Array(bag)) == ["6", "7", "9", "10"]
+			expect(bag.count) == 4
+			expect(bag.remove(using: tokens[7])) == "7"
+			expect(Array(bag)) == ["6", "9", "10"]
+		}
+
+		it("should not shift the observers of a signal when one is removed") {
+			var observers = ObserverBag<String>()
+			let tokens = (0 ..< 10).map { observers.insert("\($0)") }
+
+			for index in [1, 3, 4, 8] {
+				expect(observers.remove(using: tokens[index])) == "\(index)"
+				expect(observers.remove(using: tokens[index])).to(beNil())
+			}
+
+			expect(Array(observers)) == ["0", "2", "5", "6", "7", "9"]
+			expect(observers.count) == 6
+
+			for index in [0, 2, 5] {
+				observers.remove(using: tokens[index])
+			}
+
+			observers.insert("10")
+			expect(Array(observers)) == ["6", "7", "9", "10"]
+			expect(observers.count) == 4
+			expect(observers.remove(using: tokens[7])) == "7"
+			expect(Array(observers)) == ["6", "9", "10"]
+			expect(observers.isEmpty) == false
+		}
+
 		it("should create bag with initial values") {
 			let values = ["foo", "bar", "buzz"]
 			var bag = Bag(values)
@@ -0,0 +1,237 @@
+import Quick
+import Nimble
+import ReactiveSwift
+
+class CollectionPropertySpec: QuickSpec {
+	override func spec() {
+		describe("MutableCollectionProperty") {
+			var property: MutableCollectionProperty<Int>!
+			var changes: [[CollectionChange<Int>]] = []
+
+			beforeEach {
+				property = MutableCollectionProperty([1, 2, 3])
+				changes = []
+				property.changes.startWithValues { changes.append($0) }
+			}
+
+			it("should send a reset to the current elements upon starting") {
+				expect(changes) == [[.reset([1, 2, 3])]]
+			}
+
+			it("should send the changes of single element operations") {
+				property.append(4)
+				property.insert(0, at: 0)
+				property.remove(at: 1)
+				property.update(10, at: 0)
+				property.move(from: 0, to: 3)
+
+				expect(property.value) == [2, 3, 4, 10]
+				expect(changes) == [
+					[.reset([1, 2, 3])],
+					[.insert(4, at: 3)],
+					[.insert(0, at: 0)],
+					[.remove(at: 1)],
+					[.update(10, at: 0)],
+					[.move(from: 0, to: 3)],
+				]
+			}
+
+			it("should send the changes made in one modification as one batch") {
+				var values: [[Int]] = []
+				property.signal.observeValues { values.append($0) }
+
+				property.modify { editor in
+					editor.append(4)
+					editor.remove(at: 0)
+				}
+
+				expect(values) == [[2, 3, 4]]
+				expect(changes.last) == [.insert(4, at: 3), .remove(at: 0)]
+			}
+
+			it("should edit the elements in place") {
+				let property = MutableCollectionProperty(Array(0 ..< 1000))
+				var addresses: [UnsafeRawPointer?] = []
+
+				for index in 0 ..< 3 {
+					property.modify { editor in
+						editor.update(-1, at: index)
+						addresses.append(editor.elements.withUnsafeBufferPointer { UnsafeRawPointer($0.baseAddress) })
+					}
+				}
+
+				expect(addresses[1]) == addresses[0]
+				expect(addresses[2]) == addresses[0]
+			}
+
+			it("should send a reset when the value is set") {
+				property.value = [5]
+
+				expect(property.value) == [5]
+				expect(changes.last) == [.reset([5])]
+			}
+
+			it("should not send anything if the modification makes no change") {
+				property.modify { _ in }
+				expect(changes.count) == 1
+			}
+		}
+
+		describe("CollectionProperty") {
+			var source: MutableCollectionProperty<Int>!
+
+			beforeEach {
+				source = MutableCollectionProperty([3, 1, 4, 1, 5])
+			}
+
+			it("should map only the changed elements") {
+				var transformed: [Int] = []
+				let mapped = source.mapElements { (element: Int) -> Int in
+					transformed.append(element)
+					return element * 10
+				}
+
+				expect(mapped.value) == [30, 10, 40, 10, 50]
+				transformed = []
+
+				source.append(9)
+				source.update(2, at: 0)
+				source.remove(at: 1)
+
+				expect(mapped.value) == [20, 40, 10, 50, 90]
+				expect(transformed) == [9, 2]
+			}
+
+			it("should filter incrementally") {
+				let filtered = source.filterElements { $0 % 2 == 1 }
+				var changes: [[CollectionChange<Int>]] = []
+				filtered.changes.startWithValues { changes.append($0) }
+
+				expect(filtered.value) == [3, 1, 1, 5]
+
+				source.insert(7, at: 1)
+				source.update(6, at: 0)
+				source.remove(at: 2)
+				source.update(9, at: 2)
+				source.move(from: 0, to: 4)
+
+				expect(filtered.value) == source.value.filter { $0 % 2 == 1 }
+				expect(changes) == [
+					[.reset([3, 1, 1, 5])],
+					[.insert(7, at: 1)],
+					[.remove(at: 0)],
+					[.remove(at: 1)],
+					[.insert(9, at: 1)],
+				]
+			}
+
+			it("should sort incrementally") {
+				let sorted = source.sortedElements()
+				expect(sorted.value) == [1, 1, 3, 4, 5]
+
+				source.append(2)
+				expect(sorted.value) == [1, 1, 2, 3, 4, 5]
+
+				source.update(0, at: 2)
+				expect(sorted.value) == [0, 1, 1, 2, 3, 5]
+
+				source.remove(at: 0)
+				expect(sorted.value) == [0, 1, 1, 2, 5]
+
+				source.move(from: 0, to: 3)
+				expect(sorted.value) == [0, 1, 1, 2, 5]
+
+				source.value = [8, 7]
+				expect(sorted.value) == [7, 8]
+			}
+
+			it("should keep the filtered and sorted changes consistent with the values") {
+				let filtered = source.filterElements { $0 % 3 != 0 }
+				let sorted = source.sortedElements { $0 % 4 < $1 % 4 }
+
+				var filteredReplica: [Int] = []
+				var sortedReplica: [Int] = []
+				filtered.changes.startWithValues { filteredReplica.apply($0) }
+				sorted.changes.startWithValues { sortedReplica.apply($0) }
+
+				var seed = 42
+				func next(_ upperBound: Int) -> Int {
+					seed = (seed &* 1_103_515_245 &+ 12_345) & 0x7fff_ffff
+					return seed % upperBound
+				}
+
+				for _ in 0 ..< 500 {
+					let count = source.value.count
+					switch next(count > 0 ? 4 : 1) {
+					case 0:
+						source.insert(next(20), at: next(count + 1))
+					case 1:
+						source.remove(at: next(count))
+					case 2:
+						source.update(next(20), at: next(count))
+					default:
+						source.move(from: next(count), to: next(count))
+					}
+
+					expect(filteredReplica) == source.value.filter { $0 % 3 != 0 }
+					expect(filteredReplica) == filtered.value
+					expect(sortedReplica.map { $0 % 4 }) == source.value.map { $0 % 4 }.sorted()
+					expect(sortedReplica) == sorted.value
+				}
+			}
+
+			it("should send the values through the same signal") {
+				let mapped = source.mapElements { $0 + 1 }
+				var first: [[Int]] = []
+				var second: [[Int]] = []
+				mapped.signal.observeValues { first.append($0) }
+				mapped.signal.observeValues { second.append($0) }
+
+				source.append(8)
+				expect(first) == [[4, 2, 5, 2, 6, 9]]
+				expect(second) == first
+			}
+
+			it("should compose incremental operators") {
+				let composed = source
+					.filterElements { $0 > 1 }
+					.sortedElements(by: >)
+					.mapElements { "\($0)" }
+
+				expect(composed.value) == ["5", "4", "3"]
+
+				source.append(10)
+				expect(composed.value) == ["10", "5", "4", "3"]
+			}
+
+			it("should complete when the source deinitializes") {
+				let mapped = source.mapElements { $0 + 1 }
+				var isCompleted = false
+				mapped.signal.observeCompleted { isCompleted = true }
+
+				source = nil
+				expect(isCompleted) == true
+				expect(mapped.value) == [4, 2, 5, 2, 6]
+			}
+		}
+	}
+}
+
+private extension Array {
+	mutating func apply(_ changes: [CollectionChange<Element>]) {
+		for change in changes {
+			switch change {
+			case let .reset(elements):
+				self = elements
+			case let .insert(element, index):
+				insert(element, at: index)
+			case let .remove(index):
+				remove(at: index)
+			case let .update(element, index):
+				self[index] = element
+			case let .move(source, destination):
+				insert(remove(at: source), at: destination)
+			}
+		}
+	}
+}
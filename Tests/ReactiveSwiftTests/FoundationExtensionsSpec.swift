@@ -85,6 +85,162 @@ class FoundationExtensionsSpec: QuickSpec {
 			}
 		}
 
+		describe("file chunks") {
+			var url: URL!
+			var contents: Data!
+			var scheduler: SteppingScheduler!
+
+			beforeEach {
+				url = FileManager.default.temporaryDirectory
+					.appendingPathComponent("FoundationExtensionsSpec-\(UUID().uuidString)")
+				contents = Data((0 ..< 10_000).map { UInt8(truncatingIfNeeded: $0) })
+				scheduler = SteppingScheduler()
+
+				expect { try contents.write(to: url) }.notTo(throwError())
+			}
+
+			afterEach {
+				try? FileManager.default.removeItem(at: url)
+			}
+
+			it("should read a file handle in chunks until the end of the file") {
+				guard let handle = try? FileHandle(forReadingFrom: url) else {
+					fail("Failed to open \(String(describing: url))")
+					return
+				}
+				defer { handle.closeFile() }
+
+				var chunks: [Data] = []
+				var completed = false
+
+				handle.reactive.chunks(ofSize: 4_096, on: scheduler)
+					.on(completed: { completed = true })
+					.startWithResult { result in
+						if case let .success(chunk) = result {
+							chunks.append(chunk)
+						}
+					}
+
+				expect(chunks).to(beEmpty())
+
+				scheduler.step()
+				expect(chunks.map { $0.count }) == [4_096]
+
+				scheduler.run()
+				expect(chunks.map { $0.count }) == [4_096, 4_096, 1_808]
+				expect(Data(chunks.joined())) == contents
+				expect(completed) == true
+			}
+
+			it("should stop reading a file handle when interrupted") {
+				guard let handle = try? FileHandle(forReadingFrom: url) else {
+					fail("Failed to open \(String(describing: url))")
+					return
+				}
+				defer { handle.closeFile() }
+
+				var chunks: [Data] = []
+
+				let disposable = handle.reactive.chunks(ofSize: 1_000, on: scheduler)
+					.startWithResult { result in
+						if case let .success(chunk) = result {
+							chunks.append(chunk)
+						}
+					}
+
+				scheduler.step()
+				disposable.dispose()
+				scheduler.run()
+
+				expect(chunks.count) == 1
+				expect(handle.offsetInFile) == 1_000
+			}
+
+			it("should send the mapped contents of a file in chunks") {
+				var chunks: [Data] = []
+				var completed = false
+
+				FileManager.default.reactive.chunks(ofFileAt: url, size: 3_000, on: scheduler)
+					.on(completed: { completed = true })
+					.startWithResult { result in
+						if case let .success(chunk) = result {
+							chunks.append(chunk)
+						}
+					}
+
+				scheduler.run()
+
+				expect(chunks.map { $0.count }) == [3_000, 3_000, 3_000, 1_000]
+				expect(Data(chunks.joined())) == contents
+				expect(completed) == true
+			}
+
+			it("should fail if the file cannot be mapped") {
+				var error: Error?
+
+				FileManager.default.reactive.chunks(ofFileAt: url.appendingPathExtension("missing"), on: scheduler)
+					.startWithFailed { error = $0 }
+
+				scheduler.run()
+				expect(error).notTo(beNil())
+			}
+		}
+
+		describe("lines") {
+			func lines(of chunks: [String], separator: UInt8 = UInt8(ascii: "\n")) -> [String] {
+				var lines: [String] = []
+
+				SignalProducer<Data, Never>(chunks.map { Data($0.utf8) })
+					.lines(separator: separator)
+					.startWithValues { lines.append(String(decoding: $0, as: UTF8.self)) }
+
+				return lines
+			}
+
+			it("should split the chunks at the separators") {
+				expect(lines(of: ["a\nbc\n", "\nd\n"])) == ["a", "bc", "", "d"]
+			}
+
+			it("should join the lines spanning chunks") {
+				expect(lines(of: ["ab", "c\nd", "", "e", "f\ng"])) == ["abc", "def", "g"]
+			}
+
+			it("should split at the given separator") {
+				expect(lines(of: ["a,b", ",c"], separator: UInt8(ascii: ","))) == ["a", "b", "c"]
+			}
+
+			it("should slice the lines within a chunk without copying") {
+				// Large enough not to be stored inline.
+				let first = String(repeating: "a", count: 100)
+				let chunk = Data("\(first)\nsecond\n".utf8)
+				var lines: [Data] = []
+
+				let (signal, observer) = Signal<Data, Never>.pipe()
+				signal.lines().observeValues { lines.append($0) }
+				observer.send(value: chunk)
+
+				expect(lines.count) == 2
+				expect(lines.map { $0.startIndex }) == [0, 101]
+
+				chunk.withUnsafeBytes { chunkBytes in
+					lines[1].withUnsafeBytes { lineBytes in
+						expect(lineBytes.baseAddress) == chunkBytes.baseAddress.map { $0 + 101 }
+					}
+				}
+			}
+
+			it("should not send the remainder when interrupted") {
+				let (signal, observer) = Signal<Data, Never>.pipe()
+				var lines: [Data] = []
+
+				signal.lines().observeValues { lines.append($0) }
+				observer.send(value: Data("a\nb".utf8))
+				observer.sendInterrupted()
+
+				expect(lines) == [Data("a".utf8)]
+			}
+		}
+
 		describe("DispatchTimeInterval") {
 			it("should scale time values as expected") {
 				expect((DispatchTimeInterval.seconds(1) * 0.1).timeInterval).to(beCloseTo(DispatchTimeInterval.milliseconds(100).timeInterval))
@@ -0,0 +1,142 @@
+import Quick
+import Nimble
+@testable import ReactiveSwift
+
+class LockCheckingSpec: QuickSpec {
+	override func spec() {
+		describe("LockChecking") {
+			var violations: [LockViolation] = []
+			var originalHandler: ((LockViolation) -> Void)!
+
+			beforeEach {
+				violations = []
+				originalHandler = LockChecking.violationHandler
+				LockChecking.violationHandler = { violations.append($0) }
+				LockChecking.isEnabled = true
+			}
+
+			afterEach {
+				LockChecking.isEnabled = false
+				LockChecking.violationHandler = originalHandler
+			}
+
+			it("should not check locks created while it is disabled") {
+				LockChecking.isEnabled = false
+
+				expect(Lock.make("Unchecked") is Lock.CheckedLock) == false
+				expect(Lock.makeRecursive("Unchecked") is Lock.CheckedLock) == false
+			}
+
+			it("should check locks created while it is enabled") {
+				expect(Lock.make("Checked") is Lock.CheckedLock) == true
+				expect(Lock.makeRecursive("Checked") is Lock.CheckedLock) == true
+			}
+
+			it("should report the acquisition of two locks in the reverse order") {
+				let first = Lock.make("First")
+				let second = Lock.make("Second")
+
+				first.lock()
+				second.lock()
+				second.unlock()
+				first.unlock()
+				expect(violations).to(beEmpty())
+
+				second.lock()
+				first.lock()
+				first.unlock()
+				second.unlock()
+
+				expect(violations.count) == 1
+				expect(violations.first?.kind) == .orderInversion(heldLock: "Second")
+				expect(violations.first?.lock) == "First"
+				expect(violations.first?.heldLocks) == ["Second"]
+				expect(violations.first?.callStack).notTo(beEmpty())
+			}
+
+			it("should not report locks acquired in a consistent order") {
+				let first = Lock.make("First")
+				let second = Lock.make("Second")
+
+				for _ in 0 ..< 3 {
+					first.lock()
+					second.lock()
+					second.unlock()
+					first.unlock()
+				}
+
+				expect(violations).to(beEmpty())
+			}
+
+			it("should not report the reentrance of a recursive lock") {
+				let recursive = Lock.makeRecursive("Recursive")
+				let other = Lock.make("Other")
+
+				recursive.lock()
+				other.lock()
+				recursive.lock()
+				recursive.unlock()
+				other.unlock()
+				recursive.unlock()
+
+				expect(violations).to(beEmpty())
+			}
+
+			it("should forget the order of deinitialized locks") {
+				let first = Lock.make("First")
+
+				do {
+					let second = Lock.make("Second")
+					first.lock()
+					second.lock()
+					second.unlock()
+					first.unlock()
+				}
+
+				let third = Lock.make("Third")
+				third.lock()
+				first.lock()
+				first.unlock()
+				third.unlock()
+
+				expect(violations).to(beEmpty())
+			}
+
+			it("should report an inversion between a signal and a property") {
+				let property = MutableProperty(0)
+				let (signal, observer) = Signal<Int, Never>.pipe()
+
+				// The property box lock is held while the signal delivers.
+				property.signal.observeValues { value in
+					if value == 1 {
+						observer.send(value: 1)
+					}
+				}
+				property.value = 1
+				expect(violations).to(beEmpty())
+
+				// The signal send lock is held while the property is modified.
+				signal.observeValues { value in
+					if value == 2 {
+						property.value = 2
+					}
+				}
+				observer.send(value: 2)
+
+				expect(violations.map { $0.lock }).to(contain("PropertyBox.lock"))
+			}
+
+			it("should describe a recursive send to a signal") {
+				let violation = LockViolation(
+					kind: .recursiveAcquisition,
+					lock: "Signal.Core.sendLock",
+					heldLocks: ["Signal.Core.sendLock"],
+					callStack: ["frame"]
+				)
+
+				expect(violation.description).to(contain("sent to a Signal recursively"))
+				expect(violation.description).to(contain("frame"))
+			}
+		}
+	}
+}
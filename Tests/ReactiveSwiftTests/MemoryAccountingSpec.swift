@@ -0,0 +1,134 @@
+import Quick
+import Nimble
+import ReactiveSwift
+
+class MemoryAccountingSpec: QuickSpec {
+	override func spec() {
+		describe("MemoryAccounting") {
+			beforeEach {
+				MemoryAccounting.start()
+			}
+
+			afterEach {
+				MemoryAccounting.stop()
+			}
+
+			it("should not register objects when it is disabled") {
+				MemoryAccounting.stop()
+
+				let (signal, _) = Signal<Int, Never>.pipe()
+
+				expect(MemoryAccounting.isEnabled) == false
+				expect(MemoryAccounting.report().pipelines).to(beEmpty())
+				_ = signal
+			}
+
+			it("should account signals to the label of the current scope") {
+				let (signal, _) = MemoryAccounting.withLabel("feed") {
+					Signal<Int, Never>.pipe()
+				}
+				let (other, _) = Signal<Int, Never>.pipe()
+
+				let report = MemoryAccounting.report()
+				let feed = report.pipelines["feed"]?.components["Signal"]
+
+				expect(feed?.count) == 1
+				expect(feed?.bytes).to(beGreaterThan(0))
+				expect(report.pipelines[MemoryAccounting.unlabeled]?.components["Signal"]?.count) == 1
+				expect(report.bytes) == report.pipelines.values.reduce(0) { $0 + $1.bytes }
+				_ = (signal, other)
+			}
+
+			it("should use the innermost label") {
+				let signals = MemoryAccounting.withLabel("outer") { () -> [Signal<Int, Never>] in
+					let (outer, _) = Signal<Int, Never>.pipe()
+					let (inner, _) = MemoryAccounting.withLabel("inner") { Signal<Int, Never>.pipe() }
+					return [outer, inner]
+				}
+
+				let report = MemoryAccounting.report()
+				expect(report.pipelines["outer"]?.components["Signal"]?.count) == 1
+				expect(report.pipelines["inner"]?.components["Signal"]?.count) == 1
+				_ = signals
+			}
+
+			it("should grow with the observers of a signal") {
+				let (signal, _) = MemoryAccounting.withLabel("fan-out") { Signal<Int, Never>.pipe() }
+				let idle = MemoryAccounting.report().pipelines["fan-out"]!.bytes
+
+				for _ in 0 ..< 100 {
+					signal.observeValues { _ in }
+				}
+
+				expect(MemoryAccounting.report().pipelines["fan-out"]!.bytes) > idle
+			}
+
+			it("should account the values buffered by operators") {
+				let (left, leftObserver) = Signal<Int, Never>.pipe()
+				let (right, _) = Signal<Int, Never>.pipe()
+
+				let zipped = MemoryAccounting.withLabel("zip") { Signal.zip(left, right) }
+				zipped.observeValues { _ in }
+
+				let idle = MemoryAccounting.report().pipelines["zip"]!.components["zip"]!.bytes
+
+				for value in 0 ..< 100 {
+					leftObserver.send(value: value)
+				}
+
+				expect(MemoryAccounting.report().pipelines["zip"]!.components["zip"]!.bytes) > idle
+			}
+
+			it("should account collect and uniqueValues buffers") {
+				let (signal, observer) = Signal<Int, Never>.pipe()
+
+				MemoryAccounting.withLabel("buffers") {
+					signal.collect(count: 1_000).observeValues { _ in }
+					signal.uniqueValues().observeValues { _ in }
+				}
+
+				for value in 0 ..< 100 {
+					observer.send(value: value)
+				}
+
+				let components = MemoryAccounting.report().pipelines["buffers"]?.components
+				expect(components?["collect"]?.bytes) >= 100 * MemoryLayout<Int>.stride
+				expect(components?["uniqueValues"]?.bytes) >= 100 * MemoryLayout<Int>.stride
+			}
+
+			it("should account the queue of a test scheduler") {
+				let scheduler = MemoryAccounting.withLabel("scheduler") { TestScheduler() }
+				let idle = MemoryAccounting.report().pipelines["scheduler"]!.bytes
+
+				for _ in 0 ..< 10 {
+					scheduler.schedule {}
+				}
+
+				expect(MemoryAccounting.report().pipelines["scheduler"]!.bytes) > idle
+			}
+
+			it("should not retain objects") {
+				weak var weakSignal: Signal<Int, Never>?
+
+				MemoryAccounting.withLabel("transient") {
+					let (signal, _) = Signal<Int, Never>.pipe()
+					weakSignal = signal
+				}
+
+				expect(weakSignal).to(beNil())
+				expect(MemoryAccounting.report().pipelines["transient"]).to(beNil())
+			}
+
+			it("should check pipelines against their expected footprint") {
+				let (signal, _) = MemoryAccounting.withLabel("idle") { Signal<Int, Never>.pipe() }
+				let bytes = MemoryAccounting.report().pipelines["idle"]!.bytes
+
+				let report = MemoryAccounting.report()
+				expect(report.overBudget(["idle": bytes])).to(beEmpty())
+				expect(report.overBudget(["idle": bytes - 1])) == ["idle": 1]
+				expect(report.overBudget(["missing": 0])).to(beEmpty())
+				_ = signal
+			}
+		}
+	}
+}
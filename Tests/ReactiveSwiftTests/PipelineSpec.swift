@@ -0,0 +1,154 @@
+import Quick
+import Nimble
+import ReactiveSwift
+
+class PipelineSpec: QuickSpec {
+	override func spec() {
+		describe("Signal.pipeline") {
+			it("should forward the values through the stages in order") {
+				let (signal, observer) = Signal<Int, Never>.pipe()
+				var values: [String] = []
+
+				signal
+					.pipeline {
+						Pipeline.Filter { (value: Int) in value % 2 == 0 }
+						Pipeline.Map { (value: Int) in value * 10 }
+						Pipeline.Scan(0) { (total: Int, value: Int) in total + value }
+						Pipeline.Map { (total: Int) in "\(total)" }
+					}
+					.observeValues { values.append($0) }
+
+				for value in 1 ... 6 {
+					observer.send(value: value)
+				}
+
+				expect(values) == ["20", "60", "120"]
+			}
+
+			it("should apply a single stage") {
+				let (signal, observer) = Signal<Int, Never>.pipe()
+				var values: [Int] = []
+
+				signal
+					.pipeline {
+						Pipeline.CompactMap { (value: Int) in value > 1 ? value : nil }
+					}
+					.observeValues { values.append($0) }
+
+				observer.send(value: 1)
+				observer.send(value: 2)
+
+				expect(values) == [2]
+			}
+
+			it("should skip repeated values") {
+				let (signal, observer) = Signal<Int, Never>.pipe()
+				var values: [Int] = []
+
+				signal
+					.pipeline {
+						Pipeline.SkipRepeats<Int>()
+						Pipeline.Map { (value: Int) in value + 1 }
+					}
+					.observeValues { values.append($0) }
+
+				[1, 1, 2, 2, 2, 1].forEach(observer.send(value:))
+
+				expect(values) == [2, 3, 2]
+			}
+
+			it("should forward terminal events") {
+				let (signal, observer) = Signal<Int, TestError>.pipe()
+				var error: TestError?
+
+				signal
+					.pipeline {
+						Pipeline.Filter { (_: Int) in false }
+						Pipeline.Map { (value: Int) in value }
+					}
+					.observeFailed { error = $0 }
+
+				observer.send(value: 1)
+				observer.send(error: .default)
+
+				expect(error) == .default
+			}
+
+			it("should forward the same values as the equivalent chain of operators") {
+				let (signal, observer) = Signal<Int, Never>.pipe()
+				var chained: [Int] = []
+				var fused: [Int] = []
+
+				signal
+					.map { $0 &* 7 }
+					.filter { $0 % 3 != 0 }
+					.compactMap { $0 % 5 == 0 ? nil : $0 }
+					.scan(0) { $0 &+ $1 }
+					.skipRepeats()
+					.observeValues { chained.append($0) }
+
+				signal
+					.pipeline {
+						Pipeline.Map { (value: Int) in value &* 7 }
+						Pipeline.Filter { (value: Int) in value % 3 != 0 }
+						Pipeline.CompactMap { (value: Int) in value % 5 == 0 ? nil : value }
+						Pipeline.Scan(0) { (total: Int, value: Int) in total &+ value }
+						Pipeline.SkipRepeats<Int>()
+					}
+					.observeValues { fused.append($0) }
+
+				for value in 0 ..< 100 {
+					observer.send(value: value % 17)
+				}
+
+				expect(fused) == chained
+				expect(fused).notTo(beEmpty())
+			}
+		}
+
+		describe("SignalProducer.pipeline") {
+			it("should keep the state of the stages separately for every started producer") {
+				let producer = SignalProducer<Int, Never>([1, 2, 3])
+					.pipeline {
+						Pipeline.Scan(0) { (total: Int, value: Int) in total + value }
+						Pipeline.SkipRepeats<Int>()
+					}
+
+				var first: [Int] = []
+				var second: [Int] = []
+
+				producer.startWithValues { first.append($0) }
+				producer.startWithValues { second.append($0) }
+
+				expect(first) == [1, 3, 6]
+				expect(second) == [1, 3, 6]
+			}
+
+			it("should interoperate with the operators around it") {
+				var values: [String] = []
+				var completed = false
+
+				SignalProducer<Int, Never>(0 ..< 10)
+					.take(first: 6)
+					.pipeline {
+						Pipeline.Filter { (value: Int) in value > 2 }
+						Pipeline.Map { (value: Int) in "\(value)" }
+					}
+					.collect()
+					.start { event in
+						switch event {
+						case let .value(collected):
+							values = collected
+						case .completed:
+							completed = true
+						case .failed, .interrupted:
+							break
+						}
+					}
+
+				expect(values) == ["3", "4", "5"]
+				expect(completed) == true
+			}
+		}
+	}
+}
@@ -89,6 +89,37 @@ class PropertySpec: QuickSpec {
 				expect(count) == 2
 			}
 
+			it("should not send equal values if it skips repeats") {
+				let mutableProperty = MutableProperty(skippingRepeats: initialPropertyValue)
+				var values: [String] = []
+
+				mutableProperty.producer.startWithValues { values.append($0) }
+				expect(values) == [initialPropertyValue]
+
+				mutableProperty.value = initialPropertyValue
+				expect(values) == [initialPropertyValue]
+
+				mutableProperty.value = subsequentPropertyValue
+				expect(values) == [initialPropertyValue, subsequentPropertyValue]
+
+				mutableProperty.modify { _ in }
+				expect(values) == [initialPropertyValue, subsequentPropertyValue]
+			}
+
+			it("should not send equivalent values if it skips repeats with a custom comparator") {
+				let mutableProperty = MutableProperty(initialPropertyValue, skipsRepeats: { $0.count == $1.count })
+				var values: [String] = []
+
+				mutableProperty.signal.observeValues { values.append($0) }
+
+				mutableProperty.value = initialPropertyValue.uppercased()
+				expect(mutableProperty.value) == initialPropertyValue.uppercased()
+				expect(values) == []
+
+				mutableProperty.value = finalPropertyValue
+				expect(values) == [finalPropertyValue]
+			}
+
 			it("should complete its producer when deallocated") {
 				var mutableProperty: MutableProperty? = MutableProperty(initialPropertyValue)
 				var producerCompleted = false
@@ -99,6 +130,38 @@ class PropertySpec: QuickSpec {
 				expect(producerCompleted) == true
 			}
 
+			it("should interrupt and stop observing when a started producer is disposed of") {
+				let mutableProperty = MutableProperty(0)
+				var values: [Int] = []
+				var interrupted = false
+
+				let first = mutableProperty.producer.start { event in
+					switch event {
+					case let .value(value):
+						values.append(value)
+					case .interrupted:
+						interrupted = true
+					case .completed, .failed:
+						break
+					}
+				}
+
+				var latestValues: [Int] = []
+				let second = mutableProperty.producer.startWithValues { latestValues.append($0) }
+
+				mutableProperty.value = 1
+				first.dispose()
+				mutableProperty.value = 2
+
+				expect(values) == [0, 1]
+				expect(interrupted) == true
+				expect(latestValues) == [0, 1, 2]
+
+				second.dispose()
+				mutableProperty.value = 3
+				expect(latestValues) == [0, 1, 2]
+			}
+
 			it("should complete its signal when deallocated") {
 				var mutableProperty: MutableProperty? = MutableProperty(initialPropertyValue)
 				var signalCompleted = false
@@ -146,6 +209,38 @@ class PropertySpec: QuickSpec {
 				expect(property.value) == subsequentPropertyValue
 			}
 
+			it("should mutate copy-on-write values in place") {
+				let property = MutableProperty(Array(0 ..< 1000))
+				var addresses: [UnsafeRawPointer?] = []
+
+				for index in 0 ..< 3 {
+					property.modify { elements in
+						elements[index] = -1
+						addresses.append(elements.withUnsafeBufferPointer { UnsafeRawPointer($0.baseAddress) })
+					}
+				}
+
+				expect(addresses[1]) == addresses[0]
+				expect(addresses[2]) == addresses[0]
+			}
+
+			it("should let readers on other threads wait for a modification in progress") {
+				let property = MutableProperty(initialPropertyValue)
+				let group = DispatchGroup()
+				var valueRead: String?
+
+				property.modify { value in
+					value = subsequentPropertyValue
+
+					DispatchQueue.global().async(group: group) {
+						valueRead = property.value
+					}
+				}
+
+				group.wait()
+				expect(valueRead) == subsequentPropertyValue
+			}
+
 			it("should modify the value atomically and subsquently send out a Value event with the new value") {
 				let property = MutableProperty(initialPropertyValue)
 				var value: String?
@@ -220,6 +315,25 @@ class PropertySpec: QuickSpec {
 				expect(value) == 11
 			}
 
+			it("should not block value reads while a change is being delivered") {
+				let property = MutableProperty(0)
+				let isDelivering = DispatchSemaphore(value: 0)
+				let resume = DispatchSemaphore(value: 0)
+
+				property.signal.observeValues { _ in
+					isDelivering.signal()
+					resume.wait()
+				}
+
+				DispatchQueue.global().async {
+					property.value = 1
+				}
+
+				isDelivering.wait()
+				expect(property.value) == 1
+				resume.signal()
+			}
+
 			it("should not deadlock on recursive observation") {
 				let property = MutableProperty(0)
 
@@ -808,6 +922,71 @@ class PropertySpec: QuickSpec {
 				}
 			}
 
+			describe("lazyMap") {
+				it("should transform the value only when it is read") {
+					let property = MutableProperty(1)
+					var evaluations = 0
+					let mappedProperty = property.lazyMap { (value: Int) -> Int in
+						evaluations += 1
+						return value + 1
+					}
+
+					expect(evaluations) == 0
+
+					property.value = 2
+					property.value = 3
+					expect(evaluations) == 0
+
+					expect(mappedProperty.value) == 4
+					expect(mappedProperty.value) == 4
+					expect(evaluations) == 1
+				}
+
+				it("should propagate eagerly when it has observers") {
+					let property = MutableProperty(1)
+					var evaluations = 0
+					let mappedProperty = property.lazyMap { (value: Int) -> Int in
+						evaluations += 1
+						return value + 1
+					}
+
+					var values: [Int] = []
+					let disposable = mappedProperty.producer.startWithValues { values.append($0) }
+					expect(values) == [2]
+					expect(evaluations) == 1
+
+					property.value = 2
+					expect(values) == [2, 3]
+					expect(evaluations) == 2
+
+					disposable.dispose()
+
+					property.value = 3
+					expect(values) == [2, 3]
+					expect(evaluations) == 2
+
+					mappedProperty.signal.observeValues { values.append($0) }
+
+					property.value = 4
+					expect(values) == [2, 3, 5]
+					expect(evaluations) == 3
+				}
+
+				it("should complete when its source deinitializes") {
+					var property: MutableProperty<Int>? = MutableProperty(1)
+					let mappedProperty = property!.lazyMap { $0 + 1 }
+					var isCompleted = false
+
+					mappedProperty.signal.observeCompleted { isCompleted = true }
+
+					property!.value = 2
+					property = nil
+
+					expect(isCompleted) == true
+					expect(mappedProperty.value) == 3
+				}
+			}
+
 			describe("filter") {
 				it("should only receive values that pass the predicate")  {
 					let property = MutableProperty(1)
@@ -1969,5 +2148,216 @@ class PropertySpec: QuickSpec {
 				}
 			}
 		}
+
+		describe("PropertyTransaction") {
+			it("should defer the changes until the transaction commits") {
+				let property = MutableProperty(0)
+				var values: [Int] = []
+
+				property.signal.observeValues { values.append($0) }
+
+				PropertyTransaction.perform {
+					property.value = 1
+					expect(property.value) == 1
+					expect(values) == []
+
+					property.value = 2
+				}
+
+				expect(values) == [2]
+			}
+
+			it("should recompute a composed property only once") {
+				let first = MutableProperty(0)
+				let second = MutableProperty(0)
+				let sum = Property.combineLatest(first, second).map { $0 + $1 }
+				var values: [Int] = []
+
+				sum.signal.observeValues { values.append($0) }
+
+				PropertyTransaction.perform {
+					first.value = 1
+					second.value = 2
+				}
+
+				expect(values) == [3]
+				expect(sum.value) == 3
+
+				first.value = 10
+				second.value = 20
+				expect(values) == [3, 12, 30]
+			}
+
+			it("should propagate the changes in topological order") {
+				let root = MutableProperty(0)
+				let one = root.map { $0 + 1 }
+				let two = one.map { $0 + 1 }
+				let three = two.map { $0 + 1 }
+				let combined = Property.combineLatest(root, three)
+				var values: [String] = []
+
+				combined.signal.observeValues { values.append("\($0)-\($1)") }
+
+				PropertyTransaction.perform {
+					root.value = 10
+				}
+
+				expect(values) == ["10-13"]
+			}
+
+			it("should propagate many changes in topological order") {
+				let roots = (0 ..< 100).map { MutableProperty($0) }
+				let identities = roots.map { root in root.map { $0 } }
+				let doubled = identities.map { identity in identity.map { $0 * 2 } }
+				let total = Property.combineLatest(identities + doubled)!.map { $0.reduce(0, +) }
+				var values: [Int] = []
+
+				total.signal.observeValues { values.append($0) }
+
+				PropertyTransaction.perform {
+					for root in roots.reversed() {
+						root.value += 1
+					}
+				}
+
+				expect(values) == [3 * (0 ..< 100).reduce(0, +) + 300]
+			}
+
+			it("should not send the pending value again to a producer started in the transaction") {
+				let property = MutableProperty(0)
+				var values: [Int] = []
+
+				PropertyTransaction.perform {
+					property.value = 1
+					property.producer.startWithValues { values.append($0) }
+				}
+
+				expect(values) == [1]
+
+				property.value = 2
+				expect(values) == [1, 2]
+			}
+
+			it("should send a value changed after a producer is started in the transaction") {
+				let property = MutableProperty(0)
+				let doubled = property.map { $0 * 2 }
+				var values: [Int] = []
+				var doubledValues: [Int] = []
+
+				PropertyTransaction.perform {
+					property.value = 1
+					property.producer.startWithValues { values.append($0) }
+					doubled.producer.startWithValues { doubledValues.append($0) }
+					property.value = 2
+				}
+
+				expect(values) == [1, 2]
+				expect(doubledValues) == [0, 4]
+
+				property.value = 3
+				expect(values) == [1, 2, 3]
+				expect(doubledValues) == [0, 4, 6]
+			}
+
+			it("should propagate a single change in a transaction once per composed property") {
+				let root = MutableProperty(1)
+				let left = root.map { $0 * 2 }
+				let right = root.map { $0 * 3 }
+				var evaluations = 0
+				let sum = Property.combineLatest(left, right).map { (left: Int, right: Int) -> Int in
+					evaluations += 1
+					return left + right
+				}
+				var values: [Int] = []
+
+				sum.signal.observeValues { values.append($0) }
+				expect(evaluations) == 1
+
+				PropertyTransaction.perform {
+					root.value = 2
+				}
+
+				expect(values) == [10]
+				expect(evaluations) == 2
+			}
+
+			it("should propagate a change outside of a transaction once per composed property") {
+				let root = MutableProperty(1)
+				let left = root.map { $0 * 2 }
+				let right = root.map { $0 * 3 }
+				var evaluations = 0
+				let sum = Property.combineLatest(left, right).map { (left: Int, right: Int) -> Int in
+					evaluations += 1
+					return left + right
+				}
+				var values: [String] = []
+
+				sum.signal.observeValues { values.append("sum \($0)") }
+				root.signal.observeValues { values.append("root \($0)") }
+				expect(evaluations) == 1
+
+				root.value = 2
+				expect(values) == ["root 2", "sum 10"]
+				expect(evaluations) == 2
+
+				root.value = 3
+				expect(values) == ["root 2", "sum 10", "root 3", "sum 15"]
+				expect(evaluations) == 3
+			}
+
+			it("should complete the propagation of a nested change before it returns") {
+				let first = MutableProperty(0)
+				let second = MutableProperty(0)
+				let doubled = second.map { $0 * 2 }
+				var values: [Int] = []
+
+				doubled.signal.observeValues { values.append($0) }
+
+				first.signal.observeValues { value in
+					second.value = value
+					expect(values.last) == value * 2
+				}
+
+				first.value = 1
+				expect(values) == [2]
+			}
+
+			it("should join the outer transaction when nested") {
+				let property = MutableProperty(0)
+				var values: [Int] = []
+
+				property.signal.observeValues { values.append($0) }
+
+				PropertyTransaction.perform {
+					property.value = 1
+
+					PropertyTransaction.perform {
+						property.value = 2
+					}
+
+					expect(values) == []
+				}
+
+				expect(values) == [2]
+			}
+
+			it("should not affect changes made on other threads") {
+				let property = MutableProperty(0)
+				var values: [Int] = []
+
+				property.signal.observeValues { values.append($0) }
+
+				PropertyTransaction.perform {
+					let group = DispatchGroup()
+					DispatchQueue.global().async(group: group) { property.value = 1 }
+					group.wait()
+
+					expect(values) == [1]
+					property.value = 2
+				}
+
+				expect(values) == [1, 2]
+			}
+		}
 	}
 }
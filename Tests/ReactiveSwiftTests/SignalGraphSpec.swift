@@ -0,0 +1,157 @@
+import Foundation
+import Quick
+import Nimble
+@testable import ReactiveSwift
+
+class SignalGraphSpec: QuickSpec {
+	override func spec() {
+		describe("SignalGraph") {
+			afterEach {
+				SignalGraph.stop()
+			}
+
+			it("should not register signals when it is disabled") {
+				let (signal, _) = Signal<Int, Never>.pipe()
+				let mapped = signal.map { $0 }
+
+				expect(SignalGraph.isEnabled) == false
+				expect(SignalGraph.snapshot().nodes).to(beEmpty())
+				_ = mapped
+			}
+
+			it("should register signals and the operators connecting them") {
+				SignalGraph.start()
+				expect(SignalGraph.isEnabled) == true
+
+				let (signal, _) = Signal<Int, Never>.pipe()
+				let mapped = signal.map { String($0) }
+				mapped.observeValues { _ in }
+				mapped.observeValues { _ in }
+
+				let snapshot = SignalGraph.snapshot()
+				expect(snapshot.nodes.count) == 2
+				expect(snapshot.edges.count) == 1
+
+				let upstream = snapshot.nodes[0]
+				let downstream = snapshot.nodes[1]
+				expect(upstream.label) == "Signal<Int, Never>"
+				expect(upstream.observerCount) == 1
+				expect(downstream.label) == "Signal<String, Never>"
+				expect(downstream.observerCount) == 2
+
+				expect(snapshot.edges[0].from) == upstream.id
+				expect(snapshot.edges[0].to) == downstream.id
+				expect(snapshot.edges[0].operator) == "map(_:)"
+			}
+
+			it("should register the upstream of an operator created before it is enabled") {
+				let (signal, _) = Signal<Int, Never>.pipe()
+
+				SignalGraph.start()
+				let filtered = signal.filter { $0 > 0 }
+
+				let snapshot = SignalGraph.snapshot()
+				expect(snapshot.nodes.count) == 2
+				expect(snapshot.edges.map { $0.operator }) == ["filter(_:)"]
+				_ = filtered
+			}
+
+			it("should not keep the registrations racing with a stop") {
+				let core = StubSignalGraphCore()
+
+				SignalGraph.start()
+				SignalGraph.stop()
+
+				// A signal which has checked the switch before the stop registers late.
+				SignalGraph.register(core, label: "late")
+				SignalGraph.link(from: core, "late", to: core, "late", operator: "late")
+
+				SignalGraph.start()
+				expect(SignalGraph.snapshot().nodes).to(beEmpty())
+				expect(SignalGraph.snapshot().edges).to(beEmpty())
+			}
+
+			it("should report the status of signals") {
+				SignalGraph.start()
+
+				let (signal, observer) = Signal<Int, Never>.pipe()
+				expect(SignalGraph.snapshot().nodes.first?.status) == .alive
+
+				observer.sendCompleted()
+				expect(SignalGraph.snapshot().nodes.first?.status) == .terminated
+				_ = signal
+			}
+
+			it("should report signals kept alive only by their observers") {
+				SignalGraph.start()
+
+				var signal: Signal<Int, Never>?
+				var observer: Signal<Int, Never>.Observer?
+
+				do {
+					let pipe = Signal<Int, Never>.pipe()
+					signal = pipe.output
+					observer = pipe.input
+				}
+
+				signal?.observeValues { _ in }
+				signal = nil
+
+				let node = SignalGraph.snapshot().nodes.first { $0.observerCount == 1 }
+				expect(node?.status) == .unretained
+				observer = nil
+			}
+
+			it("should not retain signals") {
+				SignalGraph.start()
+
+				weak var weakSignal: Signal<Int, Never>?
+
+				do {
+					let (signal, _) = Signal<Int, Never>.pipe()
+					weakSignal = signal
+					expect(SignalGraph.snapshot().nodes.count) == 1
+				}
+
+				expect(weakSignal).to(beNil())
+				expect(SignalGraph.snapshot().nodes).to(beEmpty())
+			}
+
+			it("should export the graph in the DOT format") {
+				SignalGraph.start()
+
+				let (signal, _) = Signal<Int, Never>.pipe()
+				let mapped = signal.map { $0 }
+
+				let dot = SignalGraph.snapshot().dot()
+				expect(dot.hasPrefix("digraph signals {")) == true
+				expect(dot).to(contain("n1 [label=\"Signal<Int, Never>\\nalive, 1 observer(s)\"];"))
+				expect(dot).to(contain("n1 -> n2 [label=\"map(_:)\"];"))
+				_ = mapped
+			}
+
+			it("should export the graph as JSON") {
+				SignalGraph.start()
+
+				let (signal, _) = Signal<Int, Never>.pipe()
+				let mapped = signal.map { $0 }
+
+				let json = (try? JSONSerialization.jsonObject(with: SignalGraph.snapshot().json())) as? [String: Any]
+				let nodes = json?["nodes"] as? [[String: Any]]
+				let edges = json?["edges"] as? [[String: Any]]
+
+				expect(nodes?.count) == 2
+				expect(nodes?.first?["status"] as? String) == "alive"
+				expect(nodes?.first?["observerCount"] as? Int) == 1
+				expect(edges?.first?["operator"] as? String) == "map(_:)"
+				_ = mapped
+			}
+		}
+	}
+}
+
+private final class StubSignalGraphCore: SignalGraphInspectable {
+	var graphState: (status: SignalGraphNode.Status, observerCount: Int) {
+		return (.alive, 0)
+	}
+}
@@ -0,0 +1,208 @@
+import Dispatch
+import Quick
+import Nimble
+import ReactiveSwift
+
+class SignalMetricsSpec: QuickSpec {
+	override func spec() {
+		describe("SignalMetrics") {
+			beforeEach {
+				SignalMetrics.reset()
+			}
+
+			afterEach {
+				SignalMetrics.stop()
+			}
+
+			it("should not record metrics when it is disabled") {
+				SignalProducer(0 ..< 10).map { $0 + 1 }.start()
+
+				expect(SignalMetrics.isEnabled) == false
+				expect(SignalMetrics.snapshot().stages["SignalProducer.map(_:)"]).to(beNil())
+			}
+
+			it("should record the events received by every producer stage") {
+				SignalMetrics.start()
+				expect(SignalMetrics.isEnabled) == true
+
+				SignalProducer(0 ..< 10)
+					.map { $0 + 1 }
+					.filter { $0 % 2 == 0 }
+					.start()
+
+				let snapshot = SignalMetrics.snapshot()
+				let map = snapshot.stages["SignalProducer.map(_:)"]
+				let filter = snapshot.stages["SignalProducer.filter(_:)"]
+
+				expect(map?.values) == 10
+				expect(map?.completions) == 1
+				expect(map?.events) == 11
+				expect(map?.callbackDuration.count) == 11
+				expect(filter?.values) == 10
+				expect(filter?.completions) == 1
+			}
+
+			it("should record the events received by every signal stage") {
+				SignalMetrics.start()
+
+				let (signal, observer) = Signal<Int, TestError>.pipe()
+				signal.map { $0 + 1 }.observe { _ in }
+
+				observer.send(value: 1)
+				observer.send(value: 2)
+				observer.send(error: .default)
+
+				let snapshot = SignalMetrics.snapshot()
+				let map = snapshot.stages["Signal.map(_:)"]
+
+				expect(map?.values) == 2
+				expect(map?.failures) == 1
+				expect(snapshot.stages["Signal.send"]?.values).to(beGreaterThanOrEqualTo(2))
+			}
+
+			it("should not instrument stages created while it is disabled") {
+				let (signal, observer) = Signal<Int, Never>.pipe()
+				signal.map { $0 + 1 }.observeValues { _ in }
+
+				SignalMetrics.start()
+				observer.send(value: 1)
+
+				expect(SignalMetrics.snapshot().stages["Signal.map(_:)"]).to(beNil())
+			}
+
+			it("should not instrument producer stages composed while it is disabled") {
+				let producer = SignalProducer(0 ..< 10).map { $0 + 1 }
+
+				SignalMetrics.start()
+				producer.start()
+
+				expect(SignalMetrics.snapshot().stages["SignalProducer.map(_:)"]).to(beNil())
+			}
+
+			it("should reset the stages") {
+				SignalMetrics.start()
+				SignalProducer(value: 1).map { $0 }.start()
+				expect(SignalMetrics.snapshot().stages["SignalProducer.map(_:)"]).notTo(beNil())
+
+				SignalMetrics.reset()
+				expect(SignalMetrics.snapshot().stages["SignalProducer.map(_:)"]).to(beNil())
+			}
+
+			it("should merge the counters of all threads") {
+				SignalMetrics.start()
+
+				let group = DispatchGroup()
+				let queue = DispatchQueue(label: "SignalMetricsSpec", attributes: .concurrent)
+
+				for _ in 0 ..< 4 {
+					queue.async(group: group) {
+						SignalProducer(0 ..< 100).map { $0 }.start()
+					}
+				}
+				group.wait()
+
+				expect(SignalMetrics.snapshot().stages["SignalProducer.map(_:)"]?.values) == 400
+			}
+
+			it("should report the values in flight in observe(on:)") {
+				SignalMetrics.start()
+
+				let scheduler = TestScheduler()
+				let (signal, observer) = Signal<Int, Never>.pipe()
+				signal.observe(on: scheduler).observeValues { _ in }
+
+				let initial = SignalMetrics.snapshot().gauges["observe(on:)"] ?? 0
+
+				observer.send(value: 1)
+				observer.send(value: 2)
+				expect(SignalMetrics.snapshot().gauges["observe(on:)"]) == initial + 2
+
+				scheduler.run()
+				expect(SignalMetrics.snapshot().gauges["observe(on:)"]) == initial
+			}
+
+			it("should report the values buffered by zip") {
+				SignalMetrics.start()
+
+				let (left, leftObserver) = Signal<Int, Never>.pipe()
+				let (right, rightObserver) = Signal<Int, Never>.pipe()
+				Signal.zip(left, right).observeValues { _ in }
+
+				let initial = SignalMetrics.snapshot().gauges["zip"] ?? 0
+
+				leftObserver.send(value: 1)
+				leftObserver.send(value: 2)
+				expect(SignalMetrics.snapshot().gauges["zip"]) == initial + 2
+
+				rightObserver.send(value: 1)
+				expect(SignalMetrics.snapshot().gauges["zip"]) == initial + 1
+			}
+
+			it("should report the producers waiting in a concat flatten") {
+				SignalMetrics.start()
+
+				let (outer, outerObserver) = Signal<SignalProducer<Int, Never>, Never>.pipe()
+				let (inner, innerObserver) = Signal<Int, Never>.pipe()
+				outer.flatten(.concat).observeValues { _ in }
+
+				let initial = SignalMetrics.snapshot().gauges["flatten(.concurrent)"] ?? 0
+
+				outerObserver.send(value: SignalProducer(inner))
+				outerObserver.send(value: SignalProducer(value: 1))
+				outerObserver.send(value: SignalProducer(value: 2))
+				expect(SignalMetrics.snapshot().gauges["flatten(.concurrent)"]) == initial + 2
+
+				innerObserver.sendCompleted()
+				expect(SignalMetrics.snapshot().gauges["flatten(.concurrent)"]) == initial
+			}
+
+			it("should report the values buffered by replayLazily") {
+				SignalMetrics.start()
+
+				let (signal, observer) = Signal<Int, Never>.pipe()
+				let initial = SignalMetrics.snapshot().gauges["replayLazily"] ?? 0
+
+				let replayed = SignalProducer(signal).replayLazily(upTo: 2)
+				replayed.start()
+
+				observer.send(value: 1)
+				observer.send(value: 2)
+				observer.send(value: 3)
+				expect(SignalMetrics.snapshot().gauges["replayLazily"]) == initial + 2
+			}
+
+			it("should send snapshots periodically") {
+				SignalMetrics.start()
+
+				let scheduler = TestScheduler()
+				var snapshots: [SignalMetricsSnapshot] = []
+				let disposable = SignalMetrics.snapshots(every: .seconds(1), on: scheduler)
+					.startWithValues { snapshots.append($0) }
+
+				scheduler.advance(by: .seconds(3))
+				expect(snapshots.count) == 3
+
+				disposable.dispose()
+			}
+		}
+
+		describe("SignalMetricsHistogram") {
+			it("should estimate percentiles by the upper bounds of the buckets") {
+				SignalMetrics.reset()
+				SignalMetrics.start()
+				SignalProducer(0 ..< 100).map { $0 }.start()
+				SignalMetrics.stop()
+
+				let histogram = SignalMetrics.snapshot().stages["SignalProducer.map(_:)"]!.callbackDuration
+				expect(histogram.count) == 101
+				expect(histogram.buckets.count) == 65
+				expect(histogram.meanNanoseconds).notTo(beNil())
+
+				let median = histogram.percentile(50)!
+				let maximum = histogram.percentile(100)!
+				expect(median) <= maximum
+				expect(Double(maximum)) >= histogram.meanNanoseconds!
+			}
+		}
+	}
+}
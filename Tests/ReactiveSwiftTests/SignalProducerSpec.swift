@@ -351,6 +351,116 @@ class SignalProducerSpec: QuickSpec {
 			}
 		}
 
+		describe("init(_:batchSize:on:)") {
+			it("should immediately send the sequence of values") {
+				let signalProducer = SignalProducer<Int, NSError>(0 ..< 10, batchSize: 3)
+
+				expect(signalProducer).to(sendValues(Array(0 ..< 10), sendError: nil, complete: true))
+			}
+
+			it("should check for interruption between batches") {
+				var taken = 0
+				let values = (0 ..< 100).lazy.map { value -> Int in
+					taken += 1
+					return value
+				}
+
+				let result = SignalProducer<Int, Never>(values, batchSize: 8)
+					.take(first: 3)
+					.collect()
+					.single()
+
+				expect(result?.value) == [0, 1, 2]
+				expect(taken) == 8
+			}
+
+			it("should send every batch in a separate action on the scheduler") {
+				let scheduler = SteppingScheduler()
+				var values: [Int] = []
+				var completed = false
+
+				SignalProducer<Int, Never>(0 ..< 5, batchSize: 2, on: scheduler)
+					.on(completed: { completed = true })
+					.startWithValues { values.append($0) }
+
+				expect(values) == []
+
+				scheduler.step()
+				expect(values) == [0, 1]
+
+				scheduler.step()
+				expect(values) == [0, 1, 2, 3]
+				expect(completed) == false
+
+				scheduler.step()
+				expect(values) == [0, 1, 2, 3, 4]
+				expect(completed) == true
+			}
+
+			it("should not send the remaining batches when interrupted") {
+				let scheduler = SteppingScheduler()
+				var values: [Int] = []
+
+				let disposable = SignalProducer<Int, Never>(0 ..< 5, batchSize: 2, on: scheduler)
+					.startWithValues { values.append($0) }
+
+				scheduler.step()
+				disposable.dispose()
+				scheduler.run()
+
+				expect(values) == [0, 1]
+			}
+
+			it("should not grow the stack with every batch on a synchronous scheduler") {
+				var count = 0
+				var completed = false
+
+				SignalProducer<Int, Never>(0 ..< 1_000_000, batchSize: 1, on: ImmediateScheduler())
+					.on(completed: { completed = true })
+					.startWithValues { _ in count += 1 }
+
+				expect(count) == 1_000_000
+				expect(completed) == true
+			}
+		}
+
+		describe("init(chunksOf:size:on:)") {
+			it("should send the sequence in chunks") {
+				let result = SignalProducer<[Int], Never>(chunksOf: 0 ..< 7, size: 3)
+					.collect()
+					.single()
+
+				expect(result?.value) == [[0, 1, 2], [3, 4, 5], [6]]
+			}
+
+			it("should not send an empty chunk") {
+				let result = SignalProducer<[Int], Never>(chunksOf: 0 ..< 6, size: 3)
+					.collect()
+					.single()
+
+				expect(result?.value) == [[0, 1, 2], [3, 4, 5]]
+			}
+
+			it("should send every chunk in a separate action on the scheduler") {
+				let scheduler = SteppingScheduler()
+				var chunks: [[Int]] = []
+				var completed = false
+
+				SignalProducer<[Int], Never>(chunksOf: 0 ..< 4, size: 2, on: scheduler)
+					.on(completed: { completed = true })
+					.startWithValues { chunks.append($0) }
+
+				scheduler.step()
+				expect(chunks) == [[0, 1]]
+
+				scheduler.step()
+				expect(chunks) == [[0, 1], [2, 3]]
+
+				scheduler.step()
+				expect(completed) == true
+			}
+		}
+
 		describe("SignalProducer.empty") {
 			it("should immediately complete") {
 				let signalProducer = SignalProducer<Int, NSError>.empty
@@ -2667,6 +2777,66 @@ class SignalProducerSpec: QuickSpec {
 				let result = producer.take(first: 1).single()
 				expect(result?.value) == 1
 			}
+
+			it("should not grow the stack when the repetitions complete synchronously") {
+				var count = 0
+				var completed = false
+
+				SignalProducer<Int, Never>(value: 1)
+					.repeat(100_000)
+					.start { event in
+						switch event {
+						case .value:
+							count += 1
+						case .completed:
+							completed = true
+						case .failed, .interrupted:
+							break
+						}
+					}
+
+				expect(count) == 100_000
+				expect(completed) == true
+			}
+
+			it("should resume the repetitions which complete asynchronously") {
+				let scheduler = TestScheduler()
+				var values: [Int] = []
+				var completed = false
+
+				SignalProducer<Int, Never>(value: 1)
+					.delay(1, on: scheduler)
+					.repeat(3)
+					.on(completed: { completed = true })
+					.startWithValues { values.append($0) }
+
+				scheduler.advance(by: .seconds(1))
+				expect(values) == [1]
+
+				scheduler.advance(by: .seconds(2))
+				expect(values) == [1, 1, 1]
+				expect(completed) == true
+			}
+
+			it("should stop repeating when interrupted by the repeated producer") {
+				var starts = 0
+				var values: [Int] = []
+
+				let original = SignalProducer<Int, Never> { observer, _ in
+					starts += 1
+					observer.send(value: starts)
+					observer.sendCompleted()
+				}
+
+				let disposable = original
+					.repeat(Int.max)
+					.take(first: 3)
+					.startWithValues { values.append($0) }
+
+				expect(values) == [1, 2, 3]
+				expect(starts) == 3
+				expect(disposable.isDisposed) == true
+			}
 		}
 
 		describe("retry") {
@@ -2813,7 +2983,143 @@ class SignalProducerSpec: QuickSpec {
 				}
 
 			}
-			
+
+			it("should not grow the stack when the retries fail synchronously") {
+				var starts = 0
+
+				let original = SignalProducer<Int, TestError> { observer, _ in
+					starts += 1
+					observer.send(error: .default)
+				}
+
+				let result = original.retry(upTo: 100_000).single()
+
+				expect(starts) == 100_001
+				expect(result?.error) == .default
+			}
+
+			context("with backoff") {
+				var scheduler: TestScheduler!
+				var starts: [Date] = []
+				var errors: [TestError] = []
+				var original: SignalProducer<Int, TestError>!
+
+				beforeEach {
+					scheduler = TestScheduler()
+					starts = []
+					errors = []
+					original = SignalProducer { observer, _ in
+						starts.append(scheduler.currentDate)
+						observer.send(error: starts.count % 2 == 0 ? .error1 : .default)
+					}
+				}
+
+				func offsets() -> [TimeInterval] {
+					return starts.map { $0.timeIntervalSince(starts[0]) }
+				}
+
+				it("should delay the retries exponentially") {
+					original
+						.retry(upTo: 4, backoff: .exponential(initial: 1, multiplier: 2), on: scheduler)
+						.startWithFailed { errors.append($0) }
+
+					scheduler.run()
+
+					expect(offsets()) == [0, 1, 3, 7, 15]
+					expect(errors) == [.default]
+				}
+
+				it("should not delay the retries beyond the maximum") {
+					original
+						.retry(upTo: 4, backoff: .exponential(initial: 1, multiplier: 3, maximum: 5), on: scheduler)
+						.startWithFailed { errors.append($0) }
+
+					scheduler.run()
+
+					expect(offsets()) == [0, 1, 4, 9, 14]
+				}
+
+				it("should shorten the delays by the jitter") {
+					let randoms = [0.5, 0, 0.75]
+					var index = 0
+					let backoff = RetryBackoff.exponential(initial: 2, multiplier: 2, jitter: 0.5) {
+						defer { index += 1 }
+						return randoms[index]
+					}
+
+					original
+						.retry(upTo: 3, backoff: backoff, on: scheduler)
+						.startWithFailed { errors.append($0) }
+
+					scheduler.run()
+
+					expect(offsets()) == [0, 1.5, 5.5, 10.5]
+				}
+
+				it("should forward the failures rejected by the predicate without a delay") {
+					original
+						.retry(upTo: 4, backoff: .constant(1), on: scheduler, when: { $0 == .default })
+						.startWithFailed { errors.append($0) }
+
+					scheduler.advance()
+					expect(starts.count) == 1
+					expect(errors) == []
+
+					scheduler.advance(by: .seconds(1))
+					expect(starts.count) == 2
+					expect(errors) == [.error1]
+				}
+
+				it("should stop retrying when the budget is exhausted") {
+					let budget = RetryBudget(capacity: 3)
+
+					original
+						.retry(upTo: 2, backoff: .constant(1), budget: budget, on: scheduler)
+						.startWithFailed { errors.append($0) }
+					scheduler.run()
+
+					expect(starts.count) == 3
+					expect(budget.remainingRetries) == 1
+
+					original
+						.retry(upTo: 2, backoff: .constant(1), budget: budget, on: scheduler)
+						.startWithFailed { errors.append($0) }
+					scheduler.run()
+
+					expect(starts.count) == 5
+					expect(budget.remainingRetries) == 0
+					expect(errors) == [.default, .default]
+				}
+
+				it("should replenish the budget as producers are started") {
+					let budget = RetryBudget(capacity: 1, depositPerStart: 0.5)
+
+					original
+						.retry(upTo: 2, backoff: .constant(1), budget: budget, on: scheduler)
+						.startWithFailed { errors.append($0) }
+					scheduler.run()
+
+					expect(starts.count) == 2
+					expect(budget.remainingRetries) == 0
+
+					let succeeding = SignalProducer<Int, TestError>.empty
+					succeeding.retry(upTo: 2, backoff: .constant(1), budget: budget, on: scheduler).start()
+					succeeding.retry(upTo: 2, backoff: .constant(1), budget: budget, on: scheduler).start()
+
+					expect(budget.remainingRetries) == 1
+				}
+
+				it("should cancel the pending retry when disposed") {
+					let disposable = original
+						.retry(upTo: 4, backoff: .constant(1), on: scheduler)
+						.start()
+
+					disposable.dispose()
+					scheduler.run()
+
+					expect(starts.count) == 1
+				}
+			}
 		}
 
 		describe("then") {
@@ -2886,6 +3192,28 @@ class SignalProducerSpec: QuickSpec {
 				expect(completed) == true
 			}
 
+			it("should start the subsequent producer after the original has returned, if it completes synchronously") {
+				var events: [String] = []
+
+				let original = SignalProducer<Int, Never> { observer, _ in
+					observer.sendCompleted()
+					events.append("original returned")
+				}
+
+				let subsequent = SignalProducer<Int, Never> { observer, _ in
+					events.append("subsequent started")
+					observer.sendCompleted()
+				}
+
+				var completed = false
+				original.then(subsequent).startWithCompleted {
+					completed = true
+				}
+
+				expect(events) == ["original returned", "subsequent started"]
+				expect(completed) == true
+			}
+
 			it("works with Never and TestError") {
 				let producer: SignalProducer<Int, TestError> = SignalProducer<Int, Never>.empty
 					.then(SignalProducer<Int, TestError>.empty)
@@ -3127,6 +3455,127 @@ class SignalProducerSpec: QuickSpec {
 			}
 		}
 
+		describe("completion handlers of first, single, last and wait") {
+			it("should deliver the first value without blocking, and interrupt the producer") {
+				let (producer, observer) = SignalProducer<Int, TestError>.pipe()
+				var interrupted = false
+				var results: [Result<Int, TestError>?] = []
+
+				producer
+					.on(interrupted: { interrupted = true })
+					.first { results.append($0) }
+
+				expect(results.count) == 0
+
+				observer.send(value: 1)
+				observer.send(value: 2)
+
+				expect(results.count) == 1
+				expect(results.first??.value) == 1
+				expect(interrupted) == true
+			}
+
+			it("should deliver nil from first when no values are sent") {
+				var results: [Result<Int, TestError>?] = []
+				SignalProducer<Int, TestError>.empty.first { results.append($0) }
+
+				expect(results.count) == 1
+				expect(results.first ?? .success(0)).to(beNil())
+			}
+
+			it("should deliver the only value from single when the producer completes") {
+				let (producer, observer) = SignalProducer<Int, TestError>.pipe()
+				var results: [Result<Int, TestError>?] = []
+
+				producer.single { results.append($0) }
+
+				observer.send(value: 1)
+				expect(results.count) == 0
+
+				observer.sendCompleted()
+				expect(results.count) == 1
+				expect(results.first??.value) == 1
+			}
+
+			it("should deliver nil from single as soon as a second value is sent") {
+				let (producer, observer) = SignalProducer<Int, TestError>.pipe()
+				var interrupted = false
+				var results: [Result<Int, TestError>?] = []
+
+				producer
+					.on(interrupted: { interrupted = true })
+					.single { results.append($0) }
+
+				observer.send(value: 1)
+				observer.send(value: 2)
+
+				expect(results.count) == 1
+				expect(results.first ?? .success(0)).to(beNil())
+				expect(interrupted) == true
+			}
+
+			it("should deliver the last value or the error from last") {
+				let (producer, observer) = SignalProducer<Int, TestError>.pipe()
+				var results: [Result<Int, TestError>?] = []
+
+				producer.last { results.append($0) }
+				producer.last { results.append($0) }
+
+				observer.send(value: 1)
+				observer.send(value: 2)
+				observer.sendCompleted()
+
+				SignalProducer<Int, TestError>(error: .default).last { results.append($0) }
+
+				expect(results.count) == 3
+				expect(results[0]?.value) == 2
+				expect(results[1]?.value) == 2
+				expect(results[2]?.error) == .default
+			}
+
+			it("should deliver the termination from wait") {
+				var results: [Result<(), TestError>] = []
+
+				SignalProducer<Int, TestError>(value: 1).wait { results.append($0) }
+				SignalProducer<Int, TestError>(error: .default).wait { results.append($0) }
+
+				expect(results.count) == 2
+				expect(results.first?.value).toNot(beNil())
+				expect(results.last?.error) == .default
+			}
+
+			it("should interrupt the producer when disposed, and deliver the result once") {
+				let scheduler = TestScheduler()
+				var started = false
+				var results: [Result<Int, Never>?] = []
+
+				let disposable = SignalProducer<Int, Never>(value: 1)
+					.on(started: { started = true })
+					.delay(1, on: scheduler)
+					.first { results.append($0) }
+
+				expect(started) == true
+				disposable.dispose()
+
+				expect(results.count) == 1
+				expect(results.first ?? .success(0)).to(beNil())
+
+				scheduler.run()
+				expect(results.count) == 1
+			}
+
+			it("should not block the thread the producer sends events on") {
+				let scheduler = QueueScheduler.makeForTesting()
+				var result: Result<Int, Never>?
+
+				SignalProducer<Int, Never>(value: 1)
+					.start(on: scheduler)
+					.first { result = $0 }
+
+				expect(result?.value).toEventually(equal(1))
+			}
+		}
+
 		describe("observeOn") {
 			it("should immediately cancel upstream producer's work when disposed") {
 				var upstreamLifetime: Lifetime!
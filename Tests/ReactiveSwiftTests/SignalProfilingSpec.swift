@@ -0,0 +1,167 @@
+import Foundation
+import Quick
+import Nimble
+import ReactiveSwift
+
+class SignalProfilingSpec: QuickSpec {
+	override func spec() {
+		describe("SignalProfiling") {
+			afterEach {
+				SignalProfiling.stop()
+			}
+
+			it("should not enter regions when it is disabled") {
+				let (signal, observer) = Signal<Int, Never>.pipe()
+				var regions: [SignalProfilingRegion] = []
+
+				signal
+					.profiled("values")
+					.observeValues { _ in regions = SignalProfiling.currentRegions }
+
+				observer.send(value: 1)
+
+				expect(SignalProfiling.isEnabled) == false
+				expect(regions).to(beEmpty())
+			}
+
+			it("should enter the region of a stage while delivering downstream") {
+				SignalProfiling.start()
+				expect(SignalProfiling.isEnabled) == true
+
+				let (signal, observer) = Signal<Int, Never>.pipe()
+				var regions: [SignalProfilingRegion] = []
+
+				let line: UInt = #line + 2
+				signal
+					.profiled("values")
+					.map { value -> Int in
+						regions = SignalProfiling.currentRegions
+						return value
+					}
+					.observeValues { _ in }
+
+				observer.send(value: 1)
+
+				expect(regions.count) == 1
+				expect(regions.first?.name) == "values"
+				expect(regions.first?.file) == "SignalProfilingSpec.swift"
+				expect(regions.first?.line) == line
+				expect(regions.first?.description) == "values at SignalProfilingSpec.swift:\(line)"
+				expect(SignalProfiling.currentRegions).to(beEmpty())
+			}
+
+			it("should nest the regions of nested stages") {
+				SignalProfiling.start()
+
+				let (outer, outerObserver) = Signal<Int, Never>.pipe()
+				let (inner, innerObserver) = Signal<Int, Never>.pipe()
+				var regions: [String] = []
+
+				inner
+					.profiled("inner")
+					.observeValues { _ in regions = SignalProfiling.currentRegions.map { $0.name } }
+
+				outer
+					.profiled("outer")
+					.observeValues { innerObserver.send(value: $0) }
+
+				outerObserver.send(value: 1)
+
+				expect(regions) == ["outer", "inner"]
+			}
+
+			it("should enter the region of a producer stage") {
+				SignalProfiling.start()
+
+				var regions: [String] = []
+
+				SignalProducer<Int, Never>(value: 1)
+					.profiled("producer")
+					.startWithValues { _ in
+						regions.append(contentsOf: SignalProfiling.currentRegions.map { $0.name })
+					}
+
+				expect(regions) == ["producer"]
+			}
+
+			it("should not leave the operators outside any stage in a region") {
+				SignalProfiling.start()
+
+				let (signal, observer) = Signal<Int, Never>.pipe()
+				var regions: [String] = ["unset"]
+
+				signal
+					.map { value -> Int in
+						regions = SignalProfiling.currentRegions.map { $0.name }
+						return value
+					}
+					.profiled()
+					.observeValues { _ in }
+
+				observer.send(value: 1)
+
+				expect(regions).to(beEmpty())
+			}
+
+			it("should invoke the hooks when regions are entered and exited") {
+				var events: [String] = []
+
+				SignalProfiling.start(
+					willEnter: { events.append("enter \($0.name)") },
+					didExit: { events.append("exit \($0.name)") }
+				)
+
+				let (signal, observer) = Signal<Int, Never>.pipe()
+				signal
+					.profiled("values")
+					.observeValues { _ in events.append("action") }
+				observer.send(value: 1)
+
+				expect(events) == ["enter values", "action", "exit values"]
+			}
+		}
+
+		describe("SignalSampler") {
+			afterEach {
+				SignalProfiling.stop()
+			}
+
+			it("should attribute samples to the innermost region") {
+				SignalProfiling.start()
+
+				let (signal, observer) = Signal<Int, Never>.pipe()
+
+				signal
+					.profiled("sleep")
+					.map { value -> Int in
+						Thread.sleep(forTimeInterval: 0.05)
+						return value
+					}
+					.observeValues { _ in }
+
+				let sampler = SignalSampler(interval: .milliseconds(1))
+				sampler.start()
+				observer.send(value: 1)
+				let profile = sampler.stop()
+
+				let sleep = profile.selfSamples.first { $0.key.name == "sleep" }
+				expect(profile.sampleCount) > 0
+				expect(sleep?.value) > 0
+				expect(sleep.flatMap { profile.totalSamples[$0.key] }) == sleep?.value
+				expect(profile.collapsed()).to(contain("sleep at SignalProfilingSpec.swift:"))
+			}
+
+			it("should not sample threads outside any region") {
+				SignalProfiling.start()
+
+				let sampler = SignalSampler(interval: .milliseconds(1))
+				sampler.start()
+				Thread.sleep(forTimeInterval: 0.01)
+				let profile = sampler.stop()
+
+				expect(profile.stacks).to(beEmpty())
+				expect(profile.collapsed()) == ""
+			}
+		}
+	}
+}
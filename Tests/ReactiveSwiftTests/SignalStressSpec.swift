@@ -0,0 +1,471 @@
+import Dispatch
+import Foundation
+import Quick
+import Nimble
+import ReactiveSwift
+
+/// Stress tests of the termination protocol of `Signal`, which race sends,
+/// terminations, observations, disposals and deinitializations on many threads with
+/// randomized schedules, and check every observer against the event grammar.
+///
+/// The suite takes minutes, so it runs only when the `REACTIVESWIFT_STRESS`
+/// environment variable is `1`, e.g.:
+///
+/// ```
+/// REACTIVESWIFT_STRESS=1 swift test -c release --filter SignalStressSpec
+/// ```
+///
+/// The number of rounds and the seed of the schedules can be set with the
+/// `REACTIVESWIFT_STRESS_ROUNDS` and `REACTIVESWIFT_STRESS_SEED` environment
+/// variables. The throughput of every scenario is printed, so that the suite can be
+/// run as a benchmark in the release configuration.
+class SignalStressSpec: QuickSpec {
+	override func spec() {
+		let environment = ProcessInfo.processInfo.environment
+		guard environment["REACTIVESWIFT_STRESS"] == "1" else { return }
+
+		describe("Signal termination under stress") {
+			let rounds = environment["REACTIVESWIFT_STRESS_ROUNDS"].flatMap(Int.init) ?? 200
+			let seed = environment["REACTIVESWIFT_STRESS_SEED"].flatMap(UInt64.init) ?? UInt64.random(in: 0 ... .max)
+			let threads = max(4, ProcessInfo.processInfo.activeProcessorCount)
+
+			it("should deliver exactly one terminal event to every observer while sending and terminating concurrently") {
+				var operations = 0
+				var violations: [String] = []
+
+				let duration = measure {
+					for round in 0 ..< rounds {
+						var random = SplitMix64(seed: seed &+ UInt64(round))
+						let senders = threads - 2
+						let values = 1 + random.next(below: 200)
+
+						let (signal, input) = Signal<Int, TestError>.pipe()
+						let checkers = (0 ..< 4).map { _ in GrammarChecker(senders: senders) }
+						checkers.forEach { signal.observe($0.observer) }
+
+						let completedSends = (0 ..< senders).map { _ in Atomic(0) }
+						let completedBeforeTermination = Atomic<[Int]?>(nil)
+						let terminators = (0 ..< 2).map { _ in Schedule(&random, operations: 1) }
+						let schedules = (0 ..< senders).map { _ in Schedule(&random, operations: values) }
+
+						DispatchQueue.concurrentPerform(iterations: threads) { index in
+							if index < senders {
+								for sequence in 0 ..< values {
+									schedules[index].pause(before: sequence)
+									input.send(value: GrammarChecker.value(sender: index, sequence: sequence))
+									completedSends[index].value = sequence + 1
+								}
+							} else {
+								let terminator = terminators[index - senders]
+								terminator.pause(before: 0)
+
+								// Only the first terminator records the sends which have
+								// returned before any termination has started.
+								completedBeforeTermination.modify { completed in
+									if completed == nil {
+										completed = completedSends.map { $0.value }
+									}
+								}
+
+								switch terminator.pick(3) {
+								case 0:
+									input.sendCompleted()
+								case 1:
+									input.send(error: .default)
+								default:
+									input.sendInterrupted()
+								}
+							}
+						}
+
+						// No event may be delivered after the termination.
+						input.send(value: GrammarChecker.value(sender: 0, sequence: values))
+
+						operations += senders * values + 2
+
+						for checker in checkers {
+							violations += checker.verify(terminated: true, completedBeforeTermination: completedBeforeTermination.value)
+								.map { "round \(round): \($0)" }
+						}
+					}
+				}
+
+				report("send-terminate", operations: operations, duration: duration, seed: seed)
+				expect(violations).to(beEmpty(), description: "seed \(seed)")
+			}
+
+			it("should keep the event grammar while observers are added and disposed of during delivery") {
+				var operations = 0
+				var violations: [String] = []
+
+				let duration = measure {
+					for round in 0 ..< rounds {
+						var random = SplitMix64(seed: seed &+ UInt64(round))
+						let senders = threads / 2
+						let observers = threads - senders - 1
+						let values = 1 + random.next(below: 100)
+						let cycles = 1 + random.next(below: 20)
+
+						let (signal, input) = Signal<Int, TestError>.pipe()
+						let persistent = GrammarChecker(senders: senders)
+						signal.observe(persistent.observer)
+
+						let transient = (0 ..< observers).map { _ in (0 ..< cycles).map { _ in GrammarChecker(senders: senders) } }
+						let schedules = (0 ..< threads).map { _ in Schedule(&random, operations: max(values, cycles)) }
+
+						DispatchQueue.concurrentPerform(iterations: threads) { index in
+							let schedule = schedules[index]
+
+							if index < senders {
+								for sequence in 0 ..< values {
+									schedule.pause(before: sequence)
+									input.send(value: GrammarChecker.value(sender: index, sequence: sequence))
+								}
+							} else if index < senders + observers {
+								for checker in transient[index - senders] {
+									schedule.pause(before: 0)
+									let disposable = signal.observe(checker.observer)
+									schedule.pause(before: 1)
+									disposable?.dispose()
+								}
+							} else {
+								schedule.pause(before: values / 2)
+								input.sendCompleted()
+							}
+						}
+
+						operations += senders * values + observers * cycles * 2 + 1
+
+						violations += persistent.verify(terminated: true).map { "round \(round), persistent: \($0)" }
+						for checker in transient.joined() {
+							violations += checker.verify(terminated: nil, observedFromStart: false).map { "round \(round), transient: \($0)" }
+						}
+					}
+				}
+
+				report("observe-dispose", operations: operations, duration: duration, seed: seed)
+				expect(violations).to(beEmpty(), description: "seed \(seed)")
+			}
+
+			it("should dispose of the signal exactly once while racing its deinitialization") {
+				var operations = 0
+				var violations: [String] = []
+
+				let duration = measure {
+					for round in 0 ..< rounds {
+						var random = SplitMix64(seed: seed &+ UInt64(round))
+						let values = 1 + random.next(below: 50)
+						let schedules = (0 ..< 4).map { _ in Schedule(&random, operations: values) }
+
+						let disposals = Atomic(0)
+						let checker = GrammarChecker(senders: 1)
+
+						// Every reference is released by the thread which uses it.
+						var signalHolder: Signal<Int, TestError>?
+						var inputHolder: Signal<Int, TestError>.Observer?
+
+						signalHolder = Signal { input, lifetime in
+							inputHolder = input
+							lifetime.observeEnded { disposals.modify { $0 += 1 } }
+						}
+
+						let sender = InputHolder(inputHolder!)
+						let disposable = signalHolder!.observe(checker.observer)
+
+						DispatchQueue.concurrentPerform(iterations: 4) { index in
+							let schedule = schedules[index]
+							schedule.pause(before: 0)
+
+							switch index {
+							case 0:
+								// Release the last reference to the `Signal`.
+								signalHolder = nil
+							case 1:
+								// Dispose of the only observer.
+								disposable?.dispose()
+							case 2:
+								// Release one of the two references to the input observer.
+								inputHolder = nil
+							default:
+								for sequence in 0 ..< values {
+									schedule.pause(before: sequence)
+									sender.input?.send(value: GrammarChecker.value(sender: 0, sequence: sequence))
+								}
+							}
+						}
+
+						// Release the last reference to the input observer, which
+						// must not dispose of the signal again.
+						sender.input = nil
+
+						operations += values + 3
+
+						violations += checker.verify(terminated: nil, allowedTerminations: [.interrupted])
+							.map { "round \(round): \($0)" }
+
+						if disposals.value != 1 {
+							violations.append("round \(round): the signal has been disposed of \(disposals.value) times")
+						}
+					}
+				}
+
+				report("deinit", operations: operations, duration: duration, seed: seed)
+				expect(violations).to(beEmpty(), description: "seed \(seed)")
+			}
+
+			it("should interrupt observers exactly once when the input observer deinitializes concurrently") {
+				var operations = 0
+				var violations: [String] = []
+
+				let duration = measure {
+					for round in 0 ..< rounds {
+						var random = SplitMix64(seed: seed &+ UInt64(round))
+						let senders = threads - 1
+						let values = 1 + random.next(below: 100)
+						let schedules = (0 ..< threads).map { _ in Schedule(&random, operations: values) }
+
+						let signal: Signal<Int, TestError>
+						let inputs: [InputHolder]
+
+						// Every sender holds its own reference to the input observer, so
+						// the thread releasing the last reference is not known in advance.
+						do {
+							let pipe = Signal<Int, TestError>.pipe()
+							signal = pipe.output
+							inputs = (0 ..< senders).map { _ in InputHolder(pipe.input) }
+						}
+
+						let checker = GrammarChecker(senders: senders)
+						signal.observe(checker.observer)
+
+						DispatchQueue.concurrentPerform(iterations: threads) { index in
+							let schedule = schedules[index]
+
+							if index < senders {
+								for sequence in 0 ..< values {
+									schedule.pause(before: sequence)
+									inputs[index].input?.send(value: GrammarChecker.value(sender: index, sequence: sequence))
+								}
+								inputs[index].input = nil
+							} else {
+								schedule.pause(before: values / 2)
+								signal.observe(Signal.Observer())?.dispose()
+							}
+						}
+
+						operations += senders * values + 1
+
+						violations += checker.verify(terminated: true, allowedTerminations: [.interrupted])
+							.map { "round \(round): \($0)" }
+					}
+				}
+
+				report("input-deinit", operations: operations, duration: duration, seed: seed)
+				expect(violations).to(beEmpty(), description: "seed \(seed)")
+			}
+		}
+	}
+}
+
+/// Measure the duration of the given action in seconds.
+private func measure(_ action: () -> Void) -> TimeInterval {
+	let start = DispatchTime.now().uptimeNanoseconds
+	action()
+	return TimeInterval(DispatchTime.now().uptimeNanoseconds - start) / 1e9
+}
+
+private func report(_ scenario: String, operations: Int, duration: TimeInterval, seed: UInt64) {
+	print("SignalStressSpec.\(scenario): \(Int(Double(operations) / max(duration, 1e-9))) ops/s, \(operations) operations, seed \(seed)")
+}
+
+/// Records the events received by an observer, and checks them against the event
+/// grammar: values are delivered serially and in the order of every sender, and at
+/// most one terminal event is delivered, after which no event is delivered.
+private final class GrammarChecker {
+	enum Termination {
+		case completed
+		case failed
+		case interrupted
+	}
+
+	private static let senderStride = 1 << 32
+
+	private let lock = NSLock()
+	private let deliveries = Atomic(0)
+	private let senders: Int
+	private var received: [[Int]]
+	private var terminations: [Termination] = []
+	private var violations: [String] = []
+
+	/// An observer which forwards its events to the checker.
+	var observer: Signal<Int, TestError>.Observer {
+		return Signal<Int, TestError>.Observer { event in self.receive(event) }
+	}
+
+	init(senders: Int) {
+		self.senders = senders
+		self.received = Array(repeating: [], count: senders)
+	}
+
+	/// Encode the sender of a value in the value.
+	static func value(sender: Int, sequence: Int) -> Int {
+		return sender * senderStride + sequence
+	}
+
+	private func receive(_ event: Signal<Int, TestError>.Event) {
+		let isOverlapping = deliveries.modify { count -> Bool in
+			count += 1
+			return count > 1
+		}
+
+		lock.lock()
+
+		if isOverlapping {
+			violations.append("\(event) has been delivered concurrently with another event")
+		}
+
+		if let termination = terminations.first {
+			violations.append("\(event) has been delivered after \(termination)")
+		}
+
+		switch event {
+		case let .value(value):
+			received[value / GrammarChecker.senderStride].append(value % GrammarChecker.senderStride)
+		case .completed:
+			terminations.append(.completed)
+		case .failed:
+			terminations.append(.failed)
+		case .interrupted:
+			terminations.append(.interrupted)
+		}
+
+		lock.unlock()
+
+		deliveries.modify { $0 -= 1 }
+	}
+
+	/// Check the events received so far.
+	///
+	/// - parameters:
+	///   - terminated: Whether exactly one terminal event is expected, or none if
+	///                 `false`. `nil` if either is valid.
+	///   - allowedTerminations: The terminal events which may be delivered.
+	///   - observedFromStart: Whether the observer has been attached before any
+	///                        value has been sent.
+	///   - completedBeforeTermination: The number of values of every sender, of which
+	///                                 the sends had returned before the signal has
+	///                                 been terminated.
+	///
+	/// - returns: The violations of the grammar.
+	func verify(
+		terminated: Bool?,
+		allowedTerminations: [Termination] = [.completed, .failed, .interrupted],
+		observedFromStart: Bool = true,
+		completedBeforeTermination: [Int]? = nil
+	) -> [String] {
+		lock.lock()
+		defer { lock.unlock() }
+
+		var violations = self.violations
+
+		let expectedTerminations: ClosedRange<Int>
+		switch terminated {
+		case true?:
+			expectedTerminations = 1 ... 1
+		case false?:
+			expectedTerminations = 0 ... 0
+		case nil:
+			expectedTerminations = 0 ... 1
+		}
+
+		if !expectedTerminations.contains(terminations.count) {
+			violations.append("\(terminations.count) terminal events have been delivered")
+		}
+
+		for termination in terminations where !allowedTerminations.contains(termination) {
+			violations.append("\(termination) has been delivered unexpectedly")
+		}
+
+		for (sender, sequences) in received.enumerated() {
+			// The values of a sender must be delivered in order, and without gaps since
+			// a value is dropped only if the signal has started terminating, or the
+			// observer has not been attached or has been detached.
+			let first = observedFromStart ? 0 : sequences.first ?? 0
+			if sequences != Array(first ..< first + sequences.count) {
+				violations.append("the values of sender \(sender) have been delivered out of order: \(sequences.prefix(20))")
+			}
+
+			// A send which has returned before the termination has started must have been
+			// delivered.
+			if let completed = completedBeforeTermination, sequences.count < completed[sender] {
+				violations.append("\(completed[sender] - sequences.count) values of sender \(sender) sent before the termination have been dropped")
+			}
+		}
+
+		return violations
+	}
+}
+
+/// A randomized schedule of the operations of a thread, which pauses the thread for
+/// a random duration before some of its operations.
+private struct Schedule {
+	private let pauses: [Int: UInt32]
+	private let choice: Int
+
+	init(_ random: inout SplitMix64, operations: Int) {
+		var pauses: [Int: UInt32] = [:]
+		for _ in 0 ..< 1 + operations / 8 {
+			pauses[random.next(below: operations)] = UInt32(random.next(below: 50))
+		}
+
+		self.pauses = pauses
+		self.choice = random.next(below: Int.max)
+	}
+
+	/// Pause for the duration scheduled before the given operation, if any.
+	func pause(before operation: Int) {
+		guard let duration = pauses[operation] else { return }
+
+		if duration < 10 {
+			sched_yield()
+		} else {
+			usleep(duration)
+		}
+	}
+
+	/// Pick one of the given number of choices.
+	func pick(_ count: Int) -> Int {
+		return choice % count
+	}
+}
+
+/// A reference to an input observer, which is released by the thread using it.
+private final class InputHolder {
+	var input: Signal<Int, TestError>.Observer?
+
+	init(_ input: Signal<Int, TestError>.Observer) {
+		self.input = input
+	}
+}
+
+/// A seeded pseudorandom number generator, so that a failing schedule can be
+/// reproduced.
+private struct SplitMix64 {
+	private var state: UInt64
+
+	init(seed: UInt64) {
+		state = seed
+	}
+
+	mutating func next() -> UInt64 {
+		state &+= 0x9E3779B97F4A7C15
+		var z = state
+		z = (z ^ (z >> 30)) &* 0xBF58476D1CE4E5B9
+		z = (z ^ (z >> 27)) &* 0x94D049BB133111EB
+		return z ^ (z >> 31)
+	}
+
+	mutating func next(below bound: Int) -> Int {
+		return Int(next() % UInt64(max(bound, 1)))
+	}
+}
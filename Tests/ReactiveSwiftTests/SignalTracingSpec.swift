@@ -0,0 +1,191 @@
+import Foundation
+import Quick
+import Nimble
+import ReactiveSwift
+
+class SignalTracingSpec: QuickSpec {
+	override func spec() {
+		describe("SignalTracing") {
+			afterEach {
+				SignalTracing.stop()
+				_ = SignalTracing.collect()
+			}
+
+			it("should not record events when it is disabled") {
+				let (signal, observer) = Signal<Int, Never>.pipe()
+				signal.observeValues { _ in }
+
+				observer.send(value: 1)
+				observer.sendCompleted()
+
+				expect(SignalTracing.isEnabled) == false
+				expect(SignalTracing.collect()).to(beEmpty())
+			}
+
+			it("should record every event delivered by a signal") {
+				let (signal, observer) = Signal<Int, TestError>.pipe()
+				signal.observe { _ in }
+
+				SignalTracing.start()
+				expect(SignalTracing.isEnabled) == true
+
+				observer.send(value: 1)
+				observer.send(value: 2)
+				observer.send(error: .default)
+				SignalTracing.stop()
+
+				let records = SignalTracing.collect()
+				expect(records.map { $0.kind }) == [.value, .value, .failed]
+				expect(Set(records.map { $0.signal }).count) == 1
+				expect(Set(records.map { $0.thread }).count) == 1
+				expect(records.map { $0.timestamp }) == records.map { $0.timestamp }.sorted()
+			}
+
+			it("should distinguish signals") {
+				let (first, firstObserver) = Signal<Int, Never>.pipe()
+				let (second, secondObserver) = Signal<Int, Never>.pipe()
+				first.observeValues { _ in }
+				second.observeValues { _ in }
+
+				SignalTracing.start()
+				firstObserver.send(value: 1)
+				secondObserver.send(value: 1)
+				secondObserver.sendInterrupted()
+				SignalTracing.stop()
+
+				let records = SignalTracing.collect()
+				expect(records.map { $0.kind }) == [.value, .value, .interrupted]
+				expect(records[0].signal) != records[1].signal
+				expect(records[1].signal) == records[2].signal
+			}
+
+			it("should clear the records when they are collected") {
+				let (signal, observer) = Signal<Int, Never>.pipe()
+
+				SignalTracing.start()
+				observer.send(value: 1)
+				SignalTracing.stop()
+
+				expect(SignalTracing.collect().count) == 1
+				expect(SignalTracing.collect()).to(beEmpty())
+				_ = signal
+			}
+
+			it("should discard the records of a previous session when started") {
+				let (_, observer) = Signal<Int, Never>.pipe()
+
+				SignalTracing.start()
+				observer.send(value: 1)
+				SignalTracing.stop()
+
+				SignalTracing.start()
+				observer.send(value: 2)
+				SignalTracing.stop()
+
+				expect(SignalTracing.collect().count) == 1
+			}
+
+			it("should keep only the latest records of a thread when the buffer is full") {
+				let (_, observer) = Signal<Int, Never>.pipe()
+
+				SignalTracing.start(capacityPerThread: 4)
+				for value in 0 ..< 10 {
+					observer.send(value: value)
+				}
+				observer.sendCompleted()
+				SignalTracing.stop()
+
+				let records = SignalTracing.collect()
+				expect(records.map { $0.kind }) == [.value, .value, .value, .completed]
+				expect(records.map { $0.timestamp }) == records.map { $0.timestamp }.sorted()
+			}
+
+			it("should record events on every thread") {
+				let (_, observer) = Signal<Int, Never>.pipe()
+				let queue = DispatchQueue(label: "SignalTracingSpec", attributes: .concurrent)
+				let group = DispatchGroup()
+
+				SignalTracing.start()
+				for _ in 0 ..< 4 {
+					queue.async(group: group) {
+						for value in 0 ..< 100 {
+							observer.send(value: value)
+						}
+					}
+				}
+				group.wait()
+				SignalTracing.stop()
+
+				let records = SignalTracing.collect()
+				expect(records.count) == 400
+				expect(records.map { $0.timestamp }) == records.map { $0.timestamp }.sorted()
+			}
+
+			it("should collect every record once while threads are recording") {
+				let queue = DispatchQueue(label: "SignalTracingSpec", attributes: .concurrent)
+				let group = DispatchGroup()
+
+				SignalTracing.start()
+				for _ in 0 ..< 4 {
+					queue.async(group: group) {
+						let (_, observer) = Signal<Int, Never>.pipe()
+						for value in 0 ..< 1000 {
+							observer.send(value: value)
+						}
+					}
+				}
+
+				var count = 0
+				while group.wait(timeout: .now()) == .timedOut {
+					count += SignalTracing.collect().count
+				}
+				SignalTracing.stop()
+
+				count += SignalTracing.collect().count
+				expect(count) == 4000
+			}
+		}
+
+		describe("ChromeTraceExporter") {
+			it("should export the records as instant events") {
+				let records = [
+					SignalTraceRecord(signal: 0xff, kind: .value, timestamp: 1_500, thread: 1),
+					SignalTraceRecord(signal: 0xff, kind: .completed, timestamp: 3_000, thread: 2),
+				]
+
+				let data = ChromeTraceExporter().export(records)
+				let json = (try? JSONSerialization.jsonObject(with: data)) as? [String: Any]
+				let events = json?["traceEvents"] as? [[String: Any]]
+
+				expect(events?.count) == 2
+				expect(events?[0]["name"] as? String) == "value"
+				expect(events?[0]["ph"] as? String) == "i"
+				expect(events?[0]["ts"] as? Double) == 1.5
+				expect(events?[1]["name"] as? String) == "completed"
+				expect(events?[1]["tid"] as? Int) == 2
+				expect((events?[1]["args"] as? [String: Any])?["signal"] as? String) == "0xff"
+			}
+		}
+
+		describe("BinaryTraceExporter") {
+			it("should round trip the records") {
+				let records = [
+					SignalTraceRecord(signal: 0x1234_5678_9abc, kind: .value, timestamp: 42, thread: 1),
+					SignalTraceRecord(signal: 0x1234_5678_9abc, kind: .failed, timestamp: 43, thread: 1),
+					SignalTraceRecord(signal: 0xdead_beef, kind: .interrupted, timestamp: .max, thread: 7),
+				]
+
+				let data = BinaryTraceExporter().export(records)
+				expect(data.count) == 12 + records.count * 25
+				expect(BinaryTraceExporter.decode(data)) == records
+			}
+
+			it("should reject malformed traces") {
+				let data = BinaryTraceExporter().export([SignalTraceRecord(signal: 1, kind: .value, timestamp: 1, thread: 1)])
+
+				expect(BinaryTraceExporter.decode(Data("RSTQ".utf8))).to(beNil())
+				expect(BinaryTraceExporter.decode(data.dropLast())).to(beNil())
+			}
+		}
+	}
+}
@@ -0,0 +1,33 @@
+import ReactiveSwift
+
+/// A scheduler which performs its scheduled actions one at a time, in the order they
+/// have been scheduled, when it is stepped.
+///
+/// Unlike `TestScheduler`, the actions scheduled by an action are not performed
+/// until the scheduler is stepped again.
+internal final class SteppingScheduler: Scheduler {
+	private var actions: [(action: () -> Void, disposable: AnyDisposable)] = []
+
+	func schedule(_ action: @escaping () -> Void) -> Disposable? {
+		let disposable = AnyDisposable()
+		actions.append((action, disposable))
+		return disposable
+	}
+
+	/// Perform the first scheduled action, unless it has been disposed of.
+	func step() {
+		guard !actions.isEmpty else { return }
+
+		let next = actions.removeFirst()
+		if !next.disposable.isDisposed {
+			next.action()
+		}
+	}
+
+	/// Perform the scheduled actions until none is left.
+	func run() {
+		while !actions.isEmpty {
+			step()
+		}
+	}
+}
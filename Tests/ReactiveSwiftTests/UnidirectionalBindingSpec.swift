@@ -8,6 +8,28 @@ private class Object {
 	var value: Int = 0
 }
 
+private final class CountingScheduler: Scheduler {
+	let underlying = TestScheduler()
+	var scheduledCount = 0
+
+	func schedule(_ action: @escaping () -> Void) -> Disposable? {
+		scheduledCount += 1
+		return underlying.schedule(action)
+	}
+}
+
+private final class RefusingScheduler: Scheduler {
+	var isRefusing = true
+	var attemptCount = 0
+
+	func schedule(_ action: @escaping () -> Void) -> Disposable? {
+		attemptCount += 1
+		guard !isRefusing else { return nil }
+		action()
+		return nil
+	}
+}
+
 class UnidirectionalBindingSpec: QuickSpec {
 	override func spec() {
 		describe("BindingTarget") {
@@ -135,6 +157,101 @@ class UnidirectionalBindingSpec: QuickSpec {
 				}
 			}
 
+			describe("coalescing binding target") {
+				var scheduler: CountingScheduler!
+				var values: [Int] = []
+
+				beforeEach {
+					scheduler = CountingScheduler()
+					values = []
+				}
+
+				it("should deliver only the latest pending value with one scheduled delivery") {
+					let target = BindingTarget(on: scheduler, coalescing: true, lifetime: lifetime) { values.append($0) }
+
+					let property = MutableProperty(0)
+					target <~ property
+
+					for value in 1 ... 1000 {
+						property.value = value
+					}
+
+					expect(scheduler.scheduledCount) == 1
+					expect(values) == []
+
+					scheduler.underlying.run()
+					expect(values) == [1000]
+
+					property.value = 1001
+					expect(scheduler.scheduledCount) == 2
+
+					scheduler.underlying.run()
+					expect(values) == [1000, 1001]
+				}
+
+				it("should schedule later values after a scheduler refuses a delivery") {
+					let scheduler = RefusingScheduler()
+					let target = BindingTarget(on: scheduler, coalescing: true, lifetime: lifetime) { values.append($0) }
+
+					let property = MutableProperty(0)
+					target <~ property
+					property.value = 1
+
+					expect(scheduler.attemptCount) == 2
+					expect(values) == []
+
+					scheduler.isRefusing = false
+					property.value = 2
+					property.value = 3
+
+					expect(scheduler.attemptCount) == 4
+					expect(values) == [2, 3]
+				}
+
+				it("should schedule every value if coalescing is not requested") {
+					let target = BindingTarget(on: scheduler, coalescing: false, lifetime: lifetime) { values.append($0) }
+
+					let property = MutableProperty(0)
+					target <~ property
+
+					for value in 1 ... 3 {
+						property.value = value
+					}
+
+					expect(scheduler.scheduledCount) == 4
+
+					scheduler.underlying.run()
+					expect(values) == [0, 1, 2, 3]
+				}
+
+				it("should not coalesce values by default with a scheduler other than UIScheduler") {
+					let target = BindingTarget(on: scheduler, lifetime: lifetime) { values.append($0) }
+
+					let property = MutableProperty(0)
+					target <~ property
+					property.value = 1
+
+					expect(scheduler.scheduledCount) == 2
+				}
+
+				it("should coalesce values delivered on UIScheduler by default") {
+					let queue = DispatchQueue(label: #file)
+					let target = BindingTarget(on: UIScheduler(), lifetime: lifetime) { values.append($0) }
+
+					let property = MutableProperty(0)
+
+					queue.sync {
+						target <~ property
+
+						for value in 1 ... 1000 {
+							property.value = value
+						}
+					}
+
+					expect(values).toEventually(equal([1000]))
+				}
+			}
+
 			it("should not deadlock on the same queue") {
 				var value: Int?
 
@@ -69,6 +69,114 @@ class ValidatingPropertySpec: QuickSpec {
 				}
 			}
 
+			describe("asynchronous validation") {
+				var root: MutableProperty<Int>!
+				var scheduler: TestScheduler!
+				var validatedInputs: [Int] = []
+				var validationResult: FlattenedResult<Int>?
+
+				let validator: (Int) -> ValidatingProperty<Int, TestError>.Decision = { input in
+					validatedInputs.append(input)
+					return input >= 0 ? .valid : .invalid(.default)
+				}
+
+				beforeEach {
+					root = MutableProperty(0)
+					scheduler = TestScheduler()
+					validatedInputs = []
+					validationResult = nil
+				}
+
+				it("should validate the initial value synchronously") {
+					let validated = ValidatingProperty(root, on: scheduler, validator)
+
+					expect(validatedInputs) == [0]
+					expect(FlattenedResult(validated.result.value)) == FlattenedResult.valid(0)
+				}
+
+				it("should commit the value only when the validation finishes") {
+					let validated = ValidatingProperty(root, on: scheduler, validator)
+					validated.result.signal.observeValues { validationResult = FlattenedResult($0) }
+
+					validated.value = 10
+					expect(validated.value) == 0
+					expect(validationResult).to(beNil())
+
+					scheduler.run()
+					expect(validated.value) == 10
+					expect(root.value) == 10
+					expect(validationResult) == .valid(10)
+
+					validated.value = -10
+					scheduler.run()
+					expect(validated.value) == 10
+					expect(validationResult) == .errorDefault(-10)
+				}
+
+				it("should validate only the latest proposed value") {
+					let validated = ValidatingProperty(root, on: scheduler, validator)
+
+					validated.value = 1
+					validated.value = 2
+					validated.value = 3
+					scheduler.run()
+
+					expect(validatedInputs) == [0, 3]
+					expect(validated.value) == 3
+				}
+
+				it("should validate changes originated from the root property") {
+					let validated = ValidatingProperty(root, on: scheduler, validator)
+
+					root.value = -10
+					expect(FlattenedResult(validated.result.value)) == FlattenedResult.valid(0)
+
+					scheduler.run()
+					expect(validated.value) == -10
+					expect(FlattenedResult(validated.result.value)) == FlattenedResult.errorDefault(-10)
+				}
+
+				it("should discard a validation superseded while it is running") {
+					let validated = ValidatingProperty<Int, TestError>(root, on: scheduler) { input in
+						if input == 1 {
+							root.value = 2
+						}
+						return .valid
+					}
+
+					validated.value = 1
+					scheduler.run()
+
+					expect(root.value) == 2
+					expect(FlattenedResult(validated.result.value)) == FlattenedResult.valid(2)
+				}
+
+				it("should debounce the proposed values") {
+					let validated = ValidatingProperty(root, on: scheduler, debounce: 1, validator)
+
+					validated.value = 1
+					scheduler.advance(by: .milliseconds(500))
+					validated.value = 2
+					scheduler.advance(by: .milliseconds(500))
+					expect(validatedInputs) == [0]
+
+					scheduler.advance(by: .milliseconds(500))
+					expect(validatedInputs) == [0, 2]
+					expect(validated.value) == 2
+				}
+
+				it("should not retain the root property beyond its own lifetime") {
+					var validated: ValidatingProperty<Int, TestError>? = ValidatingProperty(root, on: scheduler, validator)
+					weak var weakRoot = root
+
+					root = nil
+					expect(weakRoot).notTo(beNil())
+
+					validated = nil
+					expect(weakRoot).to(beNil())
+				}
+			}
+
 			describe("a MutablePropertyProtocol dependency") {
 				var other: MutableProperty<String>!
 				var validated: ValidatingProperty<Int, TestError>!